@@ -0,0 +1,17 @@
+#include <benchmark/benchmark.h>
+
+#include "subzero/moduledrivers/ConnectorXProtocol.h"
+
+using namespace ConnectorX::Commands;
+
+static void BM_ConnectorXEncode(benchmark::State &state) {
+  Command command{.commandType = CommandType::SetNewZones, .commandData = {}};
+  command.commandData.commandSetNewZones.zoneCount = 4;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(command);
+    auto encoded = Encode(command);
+    benchmark::DoNotOptimize(encoded);
+  }
+}
+BENCHMARK(BM_ConnectorXEncode);
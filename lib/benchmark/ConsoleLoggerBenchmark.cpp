@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <streambuf>
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+
+namespace {
+// Measures formatting, not the terminal
+class NullBuffer : public std::streambuf {
+protected:
+  int overflow(int c) override { return c; }
+  std::streamsize xsputn(const char *, std::streamsize count) override {
+    return count;
+  }
+};
+
+class DiscardStdout {
+public:
+  DiscardStdout() : m_previous{std::cout.rdbuf(&m_buffer)} {}
+  ~DiscardStdout() { std::cout.rdbuf(m_previous); }
+
+private:
+  NullBuffer m_buffer;
+  std::streambuf *m_previous;
+};
+} // namespace
+
+static void BM_ConsoleLoggerPrintf(benchmark::State &state) {
+  DiscardStdout discard;
+  ConsoleWriter.SetAsync(state.range(0));
+
+  for (auto _ : state) {
+    ConsoleWriter.logInfo("Elevator", "Moving to %.2f at %d%%", 1.25, 80);
+  }
+
+  ConsoleWriter.SetAsync(false);
+}
+BENCHMARK(BM_ConsoleLoggerPrintf)->ArgName("async")->Arg(0)->Arg(1);
+
+static void BM_ConsoleLoggerFmt(benchmark::State &state) {
+  DiscardStdout discard;
+  ConsoleWriter.SetAsync(state.range(0));
+
+  for (auto _ : state) {
+    SUBZERO_LOG_INFO(ConsoleWriter, "Elevator", "Moving to {:.2f} at {}%",
+                     1.25, 80);
+  }
+
+  ConsoleWriter.SetAsync(false);
+}
+BENCHMARK(BM_ConsoleLoggerFmt)->ArgName("async")->Arg(0)->Arg(1);
@@ -0,0 +1,24 @@
+#include <benchmark/benchmark.h>
+
+#include "Fixtures.h"
+#include "subzero/utils/DetectionParser.h"
+
+using namespace subzero;
+
+static void BM_DetectionParserParse(benchmark::State &state) {
+  auto frames = benchmarks::ReadDetectionFixture("coral_detections.txt");
+  size_t objects = 0;
+
+  for (auto _ : state) {
+    for (auto &frame : frames) {
+      auto detected = DetectionParser::DetectedObject::parse(frame);
+      objects += detected.size();
+      benchmark::DoNotOptimize(detected);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * frames.size());
+  state.counters["objects/frame"] =
+      static_cast<double>(objects) / (state.iterations() * frames.size());
+}
+BENCHMARK(BM_DetectionParserParse);
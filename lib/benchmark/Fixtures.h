@@ -0,0 +1,56 @@
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace subzero::benchmarks {
+
+/**
+ * @brief Read a file from benchmark/fixtures
+ *
+ * @param name
+ * @return std::string
+ */
+inline std::string ReadFixture(std::string_view name) {
+  std::string path = SUBZERO_FIXTURE_DIR "/" + std::string{name};
+  std::ifstream file{path};
+  if (!file) {
+    throw std::runtime_error("Unable to open fixture " + path);
+  }
+
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+/**
+ * @brief Read recorded coral "detections" arrays, one frame per line; lines
+ * starting with # are comments
+ *
+ * @param name
+ * @return std::vector<std::vector<double>>
+ */
+inline std::vector<std::vector<double>>
+ReadDetectionFixture(std::string_view name) {
+  std::istringstream contents{ReadFixture(name)};
+  std::vector<std::vector<double>> frames;
+
+  std::string line;
+  while (std::getline(contents, line)) {
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+
+    std::istringstream values{line};
+    std::vector<double> &frame = frames.emplace_back();
+    for (double value; values >> value;) {
+      frame.push_back(value);
+    }
+  }
+  return frames;
+}
+} // namespace subzero::benchmarks
@@ -0,0 +1,19 @@
+#include <benchmark/benchmark.h>
+
+#include "Fixtures.h"
+#include "subzero/vision/LimelightHelpers.h"
+
+static void BM_LimelightParseResults(benchmark::State &state,
+                                     const char *fixture) {
+  std::string json = subzero::benchmarks::ReadFixture(fixture);
+
+  for (auto _ : state) {
+    auto results = LimelightHelpers::parseResults(json);
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK_CAPTURE(BM_LimelightParseResults, Detector,
+                  "limelight_detector.json");
+BENCHMARK_CAPTURE(BM_LimelightParseResults, Fiducial,
+                  "limelight_fiducial.json");
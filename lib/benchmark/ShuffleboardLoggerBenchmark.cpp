@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <frc/geometry/Pose2d.h>
+#include <frc/smartdashboard/SmartDashboard.h>
+
+#include "subzero/logging/ShuffleboardLogger.h"
+
+using namespace subzero;
+
+static void BM_SmartDashboardPutNumber(benchmark::State &state) {
+  double value = 0;
+
+  for (auto _ : state) {
+    frc::SmartDashboard::PutNumber("Benchmark/SmartDashboard", value);
+    value += 1;
+  }
+}
+BENCHMARK(BM_SmartDashboardPutNumber);
+
+static void BM_ShuffleboardLoggerByKey(benchmark::State &state) {
+  double value = 0;
+
+  for (auto _ : state) {
+    ShuffleboardLogger::getInstance().logInfo("Benchmark/ByKey", value);
+    value += 1;
+  }
+}
+BENCHMARK(BM_ShuffleboardLoggerByKey);
+
+static void BM_ShuffleboardLoggerById(benchmark::State &state) {
+  auto &logger = ShuffleboardLogger::getInstance();
+  auto id = logger.InternKey("Benchmark/ById");
+  double value = 0;
+
+  for (auto _ : state) {
+    logger.PublishNumber(id, value);
+    value += 1;
+  }
+}
+BENCHMARK(BM_ShuffleboardLoggerById);
+
+static void BM_ShuffleboardLoggerPose(benchmark::State &state) {
+  auto &logger = ShuffleboardLogger::getInstance();
+  logger.SetPosesAsStructs(state.range(0));
+  // A key per mode, so switching doesn't republish inside the timed loop
+  auto id = logger.InternKey(state.range(0) ? "Benchmark/PoseStruct"
+                                            : "Benchmark/PoseString");
+  frc::Pose2d pose{1.5_m, 2.25_m, frc::Rotation2d{0.5_rad}};
+
+  for (auto _ : state) {
+    logger.PublishPose(id, pose);
+  }
+
+  logger.SetPosesAsStructs(false);
+}
+BENCHMARK(BM_ShuffleboardLoggerPose)->ArgName("structs")->Arg(0)->Arg(1);
@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include "subzero/drivetrain/SwerveKinematics.h"
+
+using namespace subzero;
+
+// The same layout and inputs as the WPILib comparison
+const SwerveKinematics<4> kKinematics{
+    {{{0.3, 0.3}, {0.3, -0.3}, {-0.3, 0.3}, {-0.3, -0.3}}}};
+constexpr SwerveChassisSpeeds kSpeeds{1.5, -0.75, 2.0};
+
+static void BM_SwerveKinematicsToModuleSpeeds(benchmark::State &state) {
+  SwerveChassisSpeeds speeds = kSpeeds;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(speeds);
+    auto moduleSpeeds = kKinematics.ToModuleSpeeds(speeds);
+    benchmark::DoNotOptimize(moduleSpeeds);
+  }
+}
+BENCHMARK(BM_SwerveKinematicsToModuleSpeeds);
+
+static void BM_SwerveKinematicsToChassisSpeeds(benchmark::State &state) {
+  auto moduleSpeeds = kKinematics.ToModuleSpeeds(kSpeeds);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(moduleSpeeds);
+    auto speeds = kKinematics.ToChassisSpeeds(moduleSpeeds);
+    benchmark::DoNotOptimize(speeds);
+  }
+}
+BENCHMARK(BM_SwerveKinematicsToChassisSpeeds);
+
+static void BM_SwerveKinematicsDiscretize(benchmark::State &state) {
+  SwerveChassisSpeeds speeds = kSpeeds;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(speeds);
+    auto discretized = SwerveKinematics<4>::Discretize(speeds, 0.02);
+    benchmark::DoNotOptimize(discretized);
+  }
+}
+BENCHMARK(BM_SwerveKinematicsDiscretize);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "subzero/drivetrain/SwerveUtils.h"
+
+using namespace subzero;
+
+namespace {
+// Angles a few turns either side of 0, like unwrapped steering encoders
+std::vector<double> RandomAngles(size_t count, unsigned seed) {
+  std::mt19937 generator{seed};
+  std::uniform_real_distribution<double> distribution{
+      -6 * std::numbers::pi, 6 * std::numbers::pi};
+
+  std::vector<double> angles(count);
+  for (auto &angle : angles) {
+    angle = distribution(generator);
+  }
+  return angles;
+}
+} // namespace
+
+static void BM_SwerveUtilsWrapAngle(benchmark::State &state) {
+  auto angles = RandomAngles(state.range(0), 1);
+
+  for (auto _ : state) {
+    for (double angle : angles) {
+      benchmark::DoNotOptimize(SwerveUtils::WrapAngle(angle));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * angles.size());
+}
+BENCHMARK(BM_SwerveUtilsWrapAngle)->Arg(4)->Arg(1024);
+
+static void BM_SwerveUtilsStepTowardsCircular(benchmark::State &state) {
+  auto current = RandomAngles(state.range(0), 1);
+  auto target = RandomAngles(state.range(0), 2);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < current.size(); i++) {
+      benchmark::DoNotOptimize(
+          SwerveUtils::StepTowardsCircular(current[i], target[i], 0.1));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * current.size());
+}
+BENCHMARK(BM_SwerveUtilsStepTowardsCircular)->Arg(4)->Arg(1024);
+
+static void BM_SwerveUtilsAngleDifference(benchmark::State &state) {
+  auto a = RandomAngles(state.range(0), 1);
+  auto b = RandomAngles(state.range(0), 2);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < a.size(); i++) {
+      benchmark::DoNotOptimize(SwerveUtils::AngleDifference(a[i], b[i]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_SwerveUtilsAngleDifference)->Arg(4)->Arg(1024);
+
+static void BM_SwerveUtilsAngleDifferenceBatch(benchmark::State &state) {
+  auto a = RandomAngles(state.range(0), 1);
+  auto b = RandomAngles(state.range(0), 2);
+  std::vector<double> out(a.size());
+
+  for (auto _ : state) {
+    SwerveUtils::AngleDifference(a, b, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(BM_SwerveUtilsAngleDifferenceBatch)->Arg(4)->Arg(1024);
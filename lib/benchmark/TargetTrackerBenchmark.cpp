@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <frc/smartdashboard/Field2d.h>
+
+#include "Fixtures.h"
+#include "subzero/vision/TargetTracker.h"
+
+using namespace subzero;
+
+namespace {
+TargetTracker::TargetTrackerConfig MakeConfig() {
+  return {.cameraAngle = -20_deg,
+          .cameraLensHeight = 15_in,
+          .confidenceThreshold = 0.5,
+          .limelightName = "limelight",
+          .gamepieceWidth = 14_in,
+          .focalLength = 2.5,
+          .simGamepiecePose = frc::Pose2d(),
+          .gamepieceRotation = 0_deg,
+          .trigDistancePercentage = 0.5,
+          .areaPercentageThreshold = 0.001,
+          .maxTrackedItems = 4,
+          .invalidTrackedPose = frc::Pose2d(-100_m, -100_m, 0_deg)};
+}
+} // namespace
+
+static void BM_TargetTrackerGetTargets(benchmark::State &state) {
+  frc::Field2d field;
+  TargetTracker tracker{MakeConfig(), [] { return frc::Pose2d(); },
+                        [&field] { return &field; }};
+  auto results = LimelightHelpers::parseResults(
+      benchmarks::ReadFixture("limelight_detector.json"));
+
+  for (auto _ : state) {
+    auto targets = tracker.GetTargets(results);
+    benchmark::DoNotOptimize(targets);
+  }
+}
+BENCHMARK(BM_TargetTrackerGetTargets);
+
+static void BM_TargetTrackerGetDistanceToTarget(benchmark::State &state) {
+  frc::Field2d field;
+  TargetTracker tracker{MakeConfig(), [] { return frc::Pose2d(); },
+                        [&field] { return &field; }};
+  auto targets = tracker.GetTargets(LimelightHelpers::parseResults(
+      benchmarks::ReadFixture("limelight_detector.json")));
+
+  for (auto _ : state) {
+    for (auto &target : targets) {
+      benchmark::DoNotOptimize(tracker.GetDistanceToTarget(target));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * targets.size());
+}
+BENCHMARK(BM_TargetTrackerGetDistanceToTarget);
+
+// Sorts by proximity, then estimates and publishes a pose per target
+static void BM_TargetTrackerUpdateTrackedTargets(benchmark::State &state) {
+  frc::Field2d field;
+  TargetTracker tracker{MakeConfig(), [] { return frc::Pose2d(); },
+                        [&field] { return &field; }};
+  auto targets = tracker.GetTargets(LimelightHelpers::parseResults(
+      benchmarks::ReadFixture("limelight_detector.json")));
+
+  for (auto _ : state) {
+    tracker.UpdateTrackedTargets(targets);
+  }
+  state.SetItemsProcessed(state.iterations() * targets.size());
+}
+BENCHMARK(BM_TargetTrackerUpdateTrackedTargets);
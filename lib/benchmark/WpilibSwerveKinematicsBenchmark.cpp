@@ -0,0 +1,43 @@
+#include <benchmark/benchmark.h>
+
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <frc/kinematics/SwerveDriveKinematics.h>
+
+// WPILib's kinematics with the layout and inputs of SwerveKinematicsBenchmark
+const frc::SwerveDriveKinematics<4> kKinematics{
+    frc::Translation2d{0.3_m, 0.3_m}, frc::Translation2d{0.3_m, -0.3_m},
+    frc::Translation2d{-0.3_m, 0.3_m}, frc::Translation2d{-0.3_m, -0.3_m}};
+const frc::ChassisSpeeds kSpeeds{1.5_mps, -0.75_mps, 2_rad_per_s};
+
+static void BM_WpilibSwerveKinematicsToModuleStates(benchmark::State &state) {
+  frc::ChassisSpeeds speeds = kSpeeds;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(speeds);
+    auto states = kKinematics.ToSwerveModuleStates(speeds);
+    benchmark::DoNotOptimize(states);
+  }
+}
+BENCHMARK(BM_WpilibSwerveKinematicsToModuleStates);
+
+static void BM_WpilibSwerveKinematicsToChassisSpeeds(benchmark::State &state) {
+  auto states = kKinematics.ToSwerveModuleStates(kSpeeds);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(states);
+    auto speeds = kKinematics.ToChassisSpeeds(states);
+    benchmark::DoNotOptimize(speeds);
+  }
+}
+BENCHMARK(BM_WpilibSwerveKinematicsToChassisSpeeds);
+
+static void BM_WpilibChassisSpeedsDiscretize(benchmark::State &state) {
+  frc::ChassisSpeeds speeds = kSpeeds;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(speeds);
+    auto discretized = frc::ChassisSpeeds::Discretize(speeds, 20_ms);
+    benchmark::DoNotOptimize(discretized);
+  }
+}
+BENCHMARK(BM_WpilibChassisSpeedsDiscretize);
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Compare two Google Benchmark JSON results and flag regressions.
+
+Usage:
+    ./subzero_benchmarks --benchmark_out=baseline.json \
+        --benchmark_out_format=json
+    # ...make the change, rebuild...
+    ./subzero_benchmarks --benchmark_out=candidate.json \
+        --benchmark_out_format=json
+    python3 compare.py baseline.json candidate.json --threshold 0.10
+
+Exits with 1 if any benchmark got slower by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+from typing import Dict
+
+
+def load(path: str, metric: str) -> Dict[str, float]:
+    with open(path) as file:
+        data = json.load(file)
+
+    times: Dict[str, float] = {}
+    for benchmark in data["benchmarks"]:
+        # With --benchmark_repetitions, compare the medians only
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") != "median":
+                continue
+            name = benchmark["run_name"]
+        elif "run_name" in benchmark and benchmark.get("repetitions", 1) > 1:
+            continue
+        else:
+            name = benchmark["name"]
+        times[name] = benchmark[metric]
+    return times
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="allowed slowdown as a fraction (default 0.10)")
+    parser.add_argument("--metric", choices=["cpu_time", "real_time"],
+                        default="cpu_time")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    candidate = load(args.candidate, args.metric)
+
+    regressions = []
+    width = max((len(name) for name in baseline), default=20)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Candidate':>12}  "
+          f"{'Change':>8}")
+    for name, before in baseline.items():
+        if name not in candidate:
+            print(f"{name:<{width}}  {before:>12.1f}  {'missing':>12}")
+            continue
+
+        after = candidate[name]
+        change = (after - before) / before if before > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            regressions.append(name)
+            flag = "  REGRESSION"
+        print(f"{name:<{width}}  {before:>12.1f}  {after:>12.1f}  "
+              f"{change:>+8.1%}{flag}")
+
+    for name in candidate.keys() - baseline.keys():
+        print(f"{name:<{width}}  {'new':>12}  {candidate[name]:>12.1f}")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) slower by more than "
+              f"{args.threshold:.0%}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -5,9 +5,13 @@
 
 using namespace subzero;
 
+namespace {
+constexpr double kTwoPi = 2 * std::numbers::pi;
+} // namespace
+
 double SwerveUtils::StepTowards(double current, double target,
                                 double stepsize) {
-  if (abs(current - target) <= stepsize) {
+  if (std::abs(current - target) <= stepsize) {
     return target;
   } else if (target < current) {
     return current - stepsize;
@@ -22,7 +26,7 @@ double SwerveUtils::StepTowardsCircular(double current, double target,
 
   double temp = target - current;
   double stepDirection = temp > 0 ? 1 : temp < 0 ? -1 : 0;
-  double difference = abs(current - target);
+  double difference = std::abs(current - target);
 
   if (difference <= stepsize) {
     return target;
@@ -41,7 +45,7 @@ double SwerveUtils::StepTowardsCircular(double current, double target,
 }
 
 double SwerveUtils::AngleDifference(double angleA, double angleB) {
-  double difference = abs(angleA - angleB);
+  double difference = std::abs(angleA - angleB);
   return difference > std::numbers::pi ? (2 * std::numbers::pi) - difference
                                        : difference;
 }
@@ -54,7 +58,7 @@ double SwerveUtils::WrapAngle(double angle) {
     // the floor after division
     return 0.0;
   } else if (angle > twoPi) {
-    double rotations = floor(angle / twoPi);
+    double rotations = std::floor(angle / twoPi);
     // Gets the rotations back into radians and then subtracts angle by the
     // amount of full rotations
     return angle - twoPi * rotations;
@@ -63,8 +67,17 @@ double SwerveUtils::WrapAngle(double angle) {
     // rotation is added just in case the result of the floor is zero. Since the
     // _angle is negative, adding it has the effect of subtracting it from those
     // rotations, giving us a valid positive rotation
-    double rotations = floor((-angle) / twoPi) + 1;
+    double rotations = std::floor((-angle) / twoPi) + 1;
     return angle + twoPi * rotations;
   }
   return angle;
-}
\ No newline at end of file
+}
+
+void SwerveUtils::AngleDifference(std::span<const double> angleA,
+                                  std::span<const double> angleB,
+                                  std::span<double> out) {
+  for (size_t i = 0; i < angleA.size(); i++) {
+    double difference = std::abs(angleA[i] - angleB[i]);
+    out[i] = difference > std::numbers::pi ? kTwoPi - difference : difference;
+  }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "subzero/frc/smartdashboard/TaggedChooser.h"
+#include "subzero/utils/TagFilter.h"
 
 using namespace subzero;
 
@@ -62,30 +63,13 @@ template <typename T> void TaggedChooser<T>::Initialize() {
 template <typename T>
 std::vector<typename TaggedChooser<T>::TaggedChooserValue>
 TaggedChooser<T>::GetAvailableEntries() {
-  std::vector<TaggedChooserValue> availableEntries;
-  std::vector<std::string> selectedTags;
+  std::vector<std::string> selections;
+  selections.reserve(m_groups.size());
   for (auto &group : m_groups) {
-    auto selected = group.chooser->GetSelected();
-    if (selected != "ANY") {
-      selectedTags.push_back(selected);
-    }
-  }
-
-  for (auto &entry : m_entries) {
-    bool matches = true;
-    for (auto &tag : selectedTags) {
-      if (!entry.second.contains(tag)) {
-        matches = false;
-        break;
-      }
-    }
-
-    if (matches) {
-      availableEntries.push_back(entry.first);
-    }
+    selections.push_back(group.chooser->GetSelected());
   }
 
-  return availableEntries;
+  return TagFilter::Filter(m_entries, selections);
 }
 
 template <typename T> void TaggedChooser<T>::PopulateChooser() {
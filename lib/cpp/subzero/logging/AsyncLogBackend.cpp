@@ -0,0 +1,224 @@
+#include "subzero/logging/AsyncLogBackend.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+using namespace subzero;
+
+// How long the writer sleeps when there's nothing to write
+constexpr auto kIdlePeriod = std::chrono::milliseconds(5);
+constexpr size_t kIndexMask = AsyncLogBackend::kCapacity - 1;
+
+static_assert((AsyncLogBackend::kCapacity & kIndexMask) == 0,
+              "The ring capacity must be a power of 2");
+
+namespace {
+const char *LevelToString(Logging::Level level) {
+  using namespace Logging;
+
+  switch (level) {
+  case Level::VERBOSE:
+    return "VERBOSE";
+  case Level::INFO:
+    return "INFO";
+  case Level::WARNING:
+    return "WARNING";
+  case Level::ERROR:
+    return "ERROR";
+  case Level::FATAL:
+    return "FATAL";
+  default:
+    return "INVALID LOG LEVEL";
+  }
+}
+
+// Shared by direct and queued lines, so their timestamps line up
+std::chrono::steady_clock::time_point StartTime() {
+  static const auto startTime = std::chrono::steady_clock::now();
+  return startTime;
+}
+
+template <size_t N>
+void CopyTruncated(std::array<char, N> &destination, std::string_view text) {
+  size_t length = std::min(text.size(), N - 1);
+  std::memcpy(destination.data(), text.data(), length);
+  destination[length] = '\0';
+}
+} // namespace
+
+AsyncLogBackend::AsyncLogBackend()
+    : m_cells{std::make_unique<Cell[]>(kCapacity)} {
+  StartTime();
+  for (size_t i = 0; i < kCapacity; i++) {
+    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  // Enough for a full ring, so batching never allocates after startup
+  m_batch.reserve(kCapacity * (kMaxKeyLength + kMaxMessageLength + 32));
+  m_thread = std::thread([this] { Run(); });
+}
+
+bool AsyncLogBackend::Push(Logging::Level level, std::string_view key,
+                           const char *format, va_list ap) {
+  size_t position;
+  Cell *cell = Acquire(position);
+  if (!cell) {
+    return false;
+  }
+
+  cell->record.time = std::chrono::steady_clock::now();
+  cell->record.level = level;
+  CopyTruncated(cell->record.key, key);
+  vsnprintf(cell->record.message.data(), kMaxMessageLength, format, ap);
+
+  // Hand the cell to the writer
+  cell->sequence.store(position + 1, std::memory_order_release);
+  if (m_paused.load(std::memory_order_relaxed)) {
+    Wake();
+  }
+  return true;
+}
+
+bool AsyncLogBackend::Push(Logging::Level level, std::string_view key,
+                           std::string_view message) {
+  size_t position;
+  Cell *cell = Acquire(position);
+  if (!cell) {
+    return false;
+  }
+
+  cell->record.time = std::chrono::steady_clock::now();
+  cell->record.level = level;
+  CopyTruncated(cell->record.key, key);
+  CopyTruncated(cell->record.message, message);
+
+  cell->sequence.store(position + 1, std::memory_order_release);
+  if (m_paused.load(std::memory_order_relaxed)) {
+    Wake();
+  }
+  return true;
+}
+
+void AsyncLogBackend::Flush() {
+  size_t target = m_enqueuePosition.load(std::memory_order_acquire);
+  while (m_written.load(std::memory_order_acquire) < target) {
+    Wake();
+    std::this_thread::sleep_for(kIdlePeriod);
+  }
+}
+
+void AsyncLogBackend::SetPaused(bool paused) {
+  m_paused.store(paused, std::memory_order_release);
+  if (!paused) {
+    Wake();
+  }
+}
+
+void AsyncLogBackend::AppendTimestamp(
+    std::string &out, std::chrono::steady_clock::time_point time) {
+  // The first line may have been stamped just before the start time was set
+  std::chrono::duration<double> sinceStart =
+      std::max(time - StartTime(), std::chrono::steady_clock::duration::zero());
+
+  char timestamp[24];
+  std::snprintf(timestamp, sizeof(timestamp), "[%.6f] ", sinceStart.count());
+  out += timestamp;
+}
+
+void AsyncLogBackend::Wake() {
+  m_wakeups.fetch_add(1, std::memory_order_release);
+  m_wakeups.notify_one();
+}
+
+AsyncLogBackend::Cell *AsyncLogBackend::Acquire(size_t &position) {
+  position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+  while (true) {
+    Cell *cell = &m_cells[position & kIndexMask];
+    size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    auto difference = static_cast<intptr_t>(sequence) -
+                      static_cast<intptr_t>(position);
+
+    if (difference == 0) {
+      // The cell is free; claim it unless another producer got there first,
+      // in which case position is reloaded by the failed exchange
+      if (m_enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                  std::memory_order_relaxed)) {
+        return cell;
+      }
+    } else if (difference < 0) {
+      // The writer hasn't freed this cell since the last lap, so it's full
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    } else {
+      position = m_enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void AsyncLogBackend::Run() {
+  // Runs until the process exits; ConsoleLogger flushes on its way out
+  while (true) {
+    // Read before draining, so a wake-up that comes in meanwhile isn't missed
+    uint32_t wakeups = m_wakeups.load(std::memory_order_acquire);
+    if (Drain() > 0) {
+      continue;
+    }
+
+    if (m_paused.load(std::memory_order_acquire)) {
+      m_wakeups.wait(wakeups, std::memory_order_acquire);
+    } else {
+      std::this_thread::sleep_for(kIdlePeriod);
+    }
+  }
+}
+
+size_t AsyncLogBackend::Drain() {
+  size_t count = 0;
+  m_batch.clear();
+
+  while (count < kCapacity) {
+    Cell &cell = m_cells[m_dequeuePosition & kIndexMask];
+    if (cell.sequence.load(std::memory_order_acquire) !=
+        m_dequeuePosition + 1) {
+      // Empty, or the producer is still writing it
+      break;
+    }
+
+    // Taken when the record was pushed
+    AppendTimestamp(m_batch, cell.record.time);
+    m_batch += LevelToString(cell.record.level);
+    m_batch += " - ";
+    m_batch += cell.record.key.data();
+    m_batch += ": ";
+    m_batch += cell.record.message.data();
+    m_batch += '\n';
+
+    // Free the cell for the producers' next lap
+    cell.sequence.store(m_dequeuePosition + kCapacity,
+                        std::memory_order_release);
+    m_dequeuePosition++;
+    count++;
+  }
+
+  uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+  if (dropped != m_reportedDropped) {
+    AppendTimestamp(m_batch, std::chrono::steady_clock::now());
+    m_batch += "WARNING - AsyncLogBackend: dropped ";
+    m_batch += std::to_string(dropped - m_reportedDropped);
+    m_batch += " records\n";
+    m_reportedDropped = dropped;
+  }
+
+  if (!m_batch.empty()) {
+    // One write and one flush per batch instead of per line
+    std::cout.write(m_batch.data(), m_batch.size());
+    std::cout.flush();
+  }
+
+  m_written.fetch_add(count, std::memory_order_release);
+  return count;
+}
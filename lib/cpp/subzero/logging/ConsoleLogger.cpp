@@ -6,7 +6,29 @@ using namespace subzero;
 using namespace Logging;
 
 ConsoleLogger::ConsoleLogger() {
-  std::cout << "INFO - ConsoleLogger: Console Logger initialized!" << std::endl;
+  writeLine(Level::INFO, "ConsoleLogger", "Console Logger initialized!");
+}
+
+ConsoleLogger::~ConsoleLogger() { SetAsync(false); }
+
+void ConsoleLogger::SetAsync(bool async) {
+  if (async) {
+    // Starts the writer thread now rather than on the first message
+    AsyncLogBackend::getInstance().SetPaused(false);
+    m_async = true;
+  } else if (m_async) {
+    m_async = false;
+    // Nothing is queued while writing directly, so the writer can stop
+    // polling
+    AsyncLogBackend::getInstance().Flush();
+    AsyncLogBackend::getInstance().SetPaused(true);
+  }
+}
+
+void ConsoleLogger::Flush() {
+  if (m_async) {
+    AsyncLogBackend::getInstance().Flush();
+  }
 }
 
 void ConsoleLogger::logVerbose(std::string key, const std::string format, ...) {
@@ -40,6 +62,34 @@ void ConsoleLogger::logFatal(std::string key, const std::string format, ...) {
   va_end(args);
 }
 
+void ConsoleLogger::logMessage(Level level, std::string_view key,
+                               std::string_view message) {
+  if (!shouldLog(level))
+    return;
+
+  if (m_async) {
+    AsyncLogBackend::getInstance().Push(level, key, message);
+    if (level == Level::FATAL) {
+      Flush();
+    }
+    return;
+  }
+
+  writeLine(level, key, message);
+}
+
+void ConsoleLogger::writeLine(Level level, std::string_view key,
+                              std::string_view message) {
+  std::string line;
+  AsyncLogBackend::AppendTimestamp(line, std::chrono::steady_clock::now());
+  line += levelToString(level);
+  line += " - ";
+  line += key;
+  line += ": ";
+  line += message;
+  std::cout << line << std::endl;
+}
+
 void ConsoleLogger::logInfo(std::string key, int val) {
   logInfo(key, "%d", val);
 }
@@ -0,0 +1,225 @@
+#include "subzero/logging/DataLogLogger.h"
+
+#include <frc/DataLogManager.h>
+
+using namespace subzero;
+using namespace Logging;
+
+DataLogLogger::DataLogLogger() : m_log{frc::DataLogManager::GetLog()} {}
+
+std::string DataLogLogger::entryName(std::string_view key,
+                                     std::string_view type) {
+  std::string name{kEntryPrefix};
+  name += key;
+
+  auto [owner, inserted] = m_keyTypes.try_emplace(std::string{key}, type);
+  if (!inserted && owner->second != type) {
+    name += '.';
+    name += type;
+  }
+  return name;
+}
+
+void DataLogLogger::logFormat(Level level, std::string_view key,
+                              const std::string format, va_list ap) {
+  if (!shouldLog(level))
+    return;
+
+  append(m_stringEntries, key, levelToString(level) + " - " +
+                                   formatString(format, ap));
+}
+
+void DataLogLogger::logMessage(Level level, std::string_view key,
+                               std::string_view message) {
+  if (!shouldLog(level))
+    return;
+
+  append(m_stringEntries, key,
+         levelToString(level) + " - " + std::string(message));
+}
+
+void DataLogLogger::logVerbose(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::VERBOSE, key, format, args);
+  va_end(args);
+}
+void DataLogLogger::logInfo(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::INFO, key, format, args);
+  va_end(args);
+}
+void DataLogLogger::logWarning(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::WARNING, key, format, args);
+  va_end(args);
+}
+void DataLogLogger::logError(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::ERROR, key, format, args);
+  va_end(args);
+}
+void DataLogLogger::logFatal(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::FATAL, key, format, args);
+  va_end(args);
+}
+
+void DataLogLogger::logInfo(std::string key, int val) {
+  if (!shouldLog(Level::INFO))
+    return;
+
+  append(m_integerEntries, key, static_cast<int64_t>(val));
+}
+void DataLogLogger::logVerbose(std::string key, int val) {
+  if (!shouldLog(Level::VERBOSE))
+    return;
+
+  append(m_integerEntries, key, static_cast<int64_t>(val));
+}
+void DataLogLogger::logWarning(std::string key, int val) {
+  if (!shouldLog(Level::WARNING))
+    return;
+
+  append(m_integerEntries, key, static_cast<int64_t>(val));
+}
+void DataLogLogger::logError(std::string key, int val) {
+  if (!shouldLog(Level::ERROR))
+    return;
+
+  append(m_integerEntries, key, static_cast<int64_t>(val));
+}
+void DataLogLogger::logFatal(std::string key, int val) {
+  if (!shouldLog(Level::FATAL))
+    return;
+
+  append(m_integerEntries, key, static_cast<int64_t>(val));
+}
+
+void DataLogLogger::logInfo(std::string key, double val) {
+  if (!shouldLog(Level::INFO))
+    return;
+
+  append(m_doubleEntries, key, val);
+}
+void DataLogLogger::logVerbose(std::string key, double val) {
+  if (!shouldLog(Level::VERBOSE))
+    return;
+
+  append(m_doubleEntries, key, val);
+}
+void DataLogLogger::logWarning(std::string key, double val) {
+  if (!shouldLog(Level::WARNING))
+    return;
+
+  append(m_doubleEntries, key, val);
+}
+void DataLogLogger::logError(std::string key, double val) {
+  if (!shouldLog(Level::ERROR))
+    return;
+
+  append(m_doubleEntries, key, val);
+}
+void DataLogLogger::logFatal(std::string key, double val) {
+  if (!shouldLog(Level::FATAL))
+    return;
+
+  append(m_doubleEntries, key, val);
+}
+
+void DataLogLogger::logInfo(std::string key, bool val) {
+  if (!shouldLog(Level::INFO))
+    return;
+
+  append(m_booleanEntries, key, val);
+}
+void DataLogLogger::logVerbose(std::string key, bool val) {
+  if (!shouldLog(Level::VERBOSE))
+    return;
+
+  append(m_booleanEntries, key, val);
+}
+void DataLogLogger::logWarning(std::string key, bool val) {
+  if (!shouldLog(Level::WARNING))
+    return;
+
+  append(m_booleanEntries, key, val);
+}
+void DataLogLogger::logError(std::string key, bool val) {
+  if (!shouldLog(Level::ERROR))
+    return;
+
+  append(m_booleanEntries, key, val);
+}
+void DataLogLogger::logFatal(std::string key, bool val) {
+  if (!shouldLog(Level::FATAL))
+    return;
+
+  append(m_booleanEntries, key, val);
+}
+
+void DataLogLogger::logInfo(std::string key, frc::Pose2d &val) {
+  if (!shouldLog(Level::INFO))
+    return;
+
+  append(m_poseEntries, key, val);
+}
+void DataLogLogger::logVerbose(std::string key, frc::Pose2d &val) {
+  if (!shouldLog(Level::VERBOSE))
+    return;
+
+  append(m_poseEntries, key, val);
+}
+void DataLogLogger::logWarning(std::string key, frc::Pose2d &val) {
+  if (!shouldLog(Level::WARNING))
+    return;
+
+  append(m_poseEntries, key, val);
+}
+void DataLogLogger::logError(std::string key, frc::Pose2d &val) {
+  if (!shouldLog(Level::ERROR))
+    return;
+
+  append(m_poseEntries, key, val);
+}
+void DataLogLogger::logFatal(std::string key, frc::Pose2d &val) {
+  if (!shouldLog(Level::FATAL))
+    return;
+
+  append(m_poseEntries, key, val);
+}
+
+void DataLogLogger::logInfo(std::string key, wpi::Sendable *val) {
+  if (!shouldLog(Level::INFO))
+    return;
+
+  append(m_stringEntries, key, std::string_view{"Sendable"});
+}
+void DataLogLogger::logVerbose(std::string key, wpi::Sendable *val) {
+  if (!shouldLog(Level::VERBOSE))
+    return;
+
+  append(m_stringEntries, key, std::string_view{"Sendable"});
+}
+void DataLogLogger::logWarning(std::string key, wpi::Sendable *val) {
+  if (!shouldLog(Level::WARNING))
+    return;
+
+  append(m_stringEntries, key, std::string_view{"Sendable"});
+}
+void DataLogLogger::logError(std::string key, wpi::Sendable *val) {
+  if (!shouldLog(Level::ERROR))
+    return;
+
+  append(m_stringEntries, key, std::string_view{"Sendable"});
+}
+void DataLogLogger::logFatal(std::string key, wpi::Sendable *val) {
+  if (!shouldLog(Level::FATAL))
+    return;
+
+  append(m_stringEntries, key, std::string_view{"Sendable"});
+}
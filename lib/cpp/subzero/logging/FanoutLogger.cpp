@@ -0,0 +1,210 @@
+#include "subzero/logging/FanoutLogger.h"
+
+#include <frc/Timer.h>
+
+#include <algorithm>
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+using namespace Logging;
+
+FanoutLogger::FanoutLogger() {
+  // Periodic callers would otherwise print every 20 ms; warnings and above
+  // still all get through
+  AddSink(&ConsoleLogger::getInstance(), {.minPeriodPerKey = 1_s});
+}
+
+void FanoutLogger::AddSink(ILogger *sink, LogSinkOptions options) {
+  m_sinks.push_back({.logger = sink, .options = options, .keys = {}});
+}
+
+void FanoutLogger::ClearSinks() { m_sinks.clear(); }
+
+units::second_t FanoutLogger::currentTime() {
+  return frc::Timer::GetFPGATimestamp();
+}
+
+bool FanoutLogger::accepts(Sink &sink, Level level, std::string_view key,
+                           units::second_t now) {
+  const LogSinkOptions &options = sink.options;
+  if (level < options.minLevel)
+    return false;
+
+  if (level >= options.unfilteredLevel)
+    return true;
+
+  // Only track keys when a filter needs it, so unfiltered sinks don't grow a
+  // map entry per key
+  if (options.sampleEvery <= 1 && options.minPeriodPerKey <= 0_s)
+    return true;
+
+  auto it = sink.keys.find(key);
+  if (it == sink.keys.end()) {
+    it = sink.keys.try_emplace(std::string{key}).first;
+  }
+  KeyState &state = it->second;
+
+  if (state.count++ % std::max(options.sampleEvery, 1) != 0)
+    return false;
+
+  if (state.lastSent && now - *state.lastSent < options.minPeriodPerKey)
+    return false;
+
+  state.lastSent = now;
+  return true;
+}
+
+void FanoutLogger::logFormat(Level level, std::string_view key,
+                             const std::string format, va_list ap) {
+  std::optional<std::string> message;
+  dispatch(level, key, [&](ILogger &sink) {
+    // Formatted at most once, and only if some sink wants it
+    if (!message) {
+      message = formatString(format, ap);
+    }
+    sink.logMessage(level, key, *message);
+  });
+}
+
+void FanoutLogger::logMessage(Level level, std::string_view key,
+                              std::string_view message) {
+  dispatch(level, key,
+           [&](ILogger &sink) { sink.logMessage(level, key, message); });
+}
+
+void FanoutLogger::logVerbose(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::VERBOSE, key, format, args);
+  va_end(args);
+}
+void FanoutLogger::logInfo(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::INFO, key, format, args);
+  va_end(args);
+}
+void FanoutLogger::logWarning(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::WARNING, key, format, args);
+  va_end(args);
+}
+void FanoutLogger::logError(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::ERROR, key, format, args);
+  va_end(args);
+}
+void FanoutLogger::logFatal(std::string key, const std::string format, ...) {
+  va_list args;
+  va_start(args, format);
+  logFormat(Level::FATAL, key, format, args);
+  va_end(args);
+}
+
+void FanoutLogger::logInfo(std::string key, int val) {
+  dispatch(Level::INFO, key,
+           [&](ILogger &sink) { sink.logInfo(key, val); });
+}
+void FanoutLogger::logVerbose(std::string key, int val) {
+  dispatch(Level::VERBOSE, key,
+           [&](ILogger &sink) { sink.logVerbose(key, val); });
+}
+void FanoutLogger::logWarning(std::string key, int val) {
+  dispatch(Level::WARNING, key,
+           [&](ILogger &sink) { sink.logWarning(key, val); });
+}
+void FanoutLogger::logError(std::string key, int val) {
+  dispatch(Level::ERROR, key,
+           [&](ILogger &sink) { sink.logError(key, val); });
+}
+void FanoutLogger::logFatal(std::string key, int val) {
+  dispatch(Level::FATAL, key,
+           [&](ILogger &sink) { sink.logFatal(key, val); });
+}
+
+void FanoutLogger::logInfo(std::string key, double val) {
+  dispatch(Level::INFO, key,
+           [&](ILogger &sink) { sink.logInfo(key, val); });
+}
+void FanoutLogger::logVerbose(std::string key, double val) {
+  dispatch(Level::VERBOSE, key,
+           [&](ILogger &sink) { sink.logVerbose(key, val); });
+}
+void FanoutLogger::logWarning(std::string key, double val) {
+  dispatch(Level::WARNING, key,
+           [&](ILogger &sink) { sink.logWarning(key, val); });
+}
+void FanoutLogger::logError(std::string key, double val) {
+  dispatch(Level::ERROR, key,
+           [&](ILogger &sink) { sink.logError(key, val); });
+}
+void FanoutLogger::logFatal(std::string key, double val) {
+  dispatch(Level::FATAL, key,
+           [&](ILogger &sink) { sink.logFatal(key, val); });
+}
+
+void FanoutLogger::logInfo(std::string key, bool val) {
+  dispatch(Level::INFO, key,
+           [&](ILogger &sink) { sink.logInfo(key, val); });
+}
+void FanoutLogger::logVerbose(std::string key, bool val) {
+  dispatch(Level::VERBOSE, key,
+           [&](ILogger &sink) { sink.logVerbose(key, val); });
+}
+void FanoutLogger::logWarning(std::string key, bool val) {
+  dispatch(Level::WARNING, key,
+           [&](ILogger &sink) { sink.logWarning(key, val); });
+}
+void FanoutLogger::logError(std::string key, bool val) {
+  dispatch(Level::ERROR, key,
+           [&](ILogger &sink) { sink.logError(key, val); });
+}
+void FanoutLogger::logFatal(std::string key, bool val) {
+  dispatch(Level::FATAL, key,
+           [&](ILogger &sink) { sink.logFatal(key, val); });
+}
+
+void FanoutLogger::logInfo(std::string key, frc::Pose2d &val) {
+  dispatch(Level::INFO, key,
+           [&](ILogger &sink) { sink.logInfo(key, val); });
+}
+void FanoutLogger::logVerbose(std::string key, frc::Pose2d &val) {
+  dispatch(Level::VERBOSE, key,
+           [&](ILogger &sink) { sink.logVerbose(key, val); });
+}
+void FanoutLogger::logWarning(std::string key, frc::Pose2d &val) {
+  dispatch(Level::WARNING, key,
+           [&](ILogger &sink) { sink.logWarning(key, val); });
+}
+void FanoutLogger::logError(std::string key, frc::Pose2d &val) {
+  dispatch(Level::ERROR, key,
+           [&](ILogger &sink) { sink.logError(key, val); });
+}
+void FanoutLogger::logFatal(std::string key, frc::Pose2d &val) {
+  dispatch(Level::FATAL, key,
+           [&](ILogger &sink) { sink.logFatal(key, val); });
+}
+
+void FanoutLogger::logInfo(std::string key, wpi::Sendable *val) {
+  dispatch(Level::INFO, key,
+           [&](ILogger &sink) { sink.logInfo(key, val); });
+}
+void FanoutLogger::logVerbose(std::string key, wpi::Sendable *val) {
+  dispatch(Level::VERBOSE, key,
+           [&](ILogger &sink) { sink.logVerbose(key, val); });
+}
+void FanoutLogger::logWarning(std::string key, wpi::Sendable *val) {
+  dispatch(Level::WARNING, key,
+           [&](ILogger &sink) { sink.logWarning(key, val); });
+}
+void FanoutLogger::logError(std::string key, wpi::Sendable *val) {
+  dispatch(Level::ERROR, key,
+           [&](ILogger &sink) { sink.logError(key, val); });
+}
+void FanoutLogger::logFatal(std::string key, wpi::Sendable *val) {
+  dispatch(Level::FATAL, key,
+           [&](ILogger &sink) { sink.logFatal(key, val); });
+}
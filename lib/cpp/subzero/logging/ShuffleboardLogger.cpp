@@ -1,6 +1,7 @@
 #include "subzero/logging/ShuffleboardLogger.h"
 
 #include <frc/smartdashboard/SmartDashboard.h>
+#include <networktables/NetworkTableInstance.h>
 #include <wpi/json.h>
 
 using namespace subzero;
@@ -8,59 +9,144 @@ using namespace Logging;
 
 ShuffleboardLogger::ShuffleboardLogger() {}
 
-void ShuffleboardLogger::logVerbose(std::string key, const std::string format,
-                                    ...) {
-  if (!shouldLog(Level::VERBOSE))
+ShuffleboardLogger::KeyId ShuffleboardLogger::InternKey(std::string_view key) {
+  std::lock_guard lock{m_mutex};
+  auto it = m_keyIds.find(key);
+  if (it != m_keyIds.end()) {
+    return it->second;
+  }
+
+  KeyId id = m_publishers.size();
+  m_publishers.push_back({.topic = "/SmartDashboard/" + std::string{key}});
+  m_keyIds.try_emplace(std::string{key}, id);
+  return id;
+}
+
+void ShuffleboardLogger::releasePublishers(KeyPublishers &publishers) {
+  // A topic only takes one type, so a key logged as a number and then as a
+  // message is unpublished and republished as a string
+  publishers.number = {};
+  publishers.boolean = {};
+  publishers.string = {};
+  publishers.pose = {};
+}
+
+void ShuffleboardLogger::PublishNumber(KeyId id, double val) {
+  std::lock_guard lock{m_mutex};
+  auto &publishers = m_publishers[id];
+  if (!publishers.number) {
+    releasePublishers(publishers);
+    publishers.number = nt::NetworkTableInstance::GetDefault()
+                            .GetDoubleTopic(publishers.topic)
+                            .Publish();
+  }
+  publishers.number.Set(val);
+}
+
+void ShuffleboardLogger::PublishBoolean(KeyId id, bool val) {
+  std::lock_guard lock{m_mutex};
+  auto &publishers = m_publishers[id];
+  if (!publishers.boolean) {
+    releasePublishers(publishers);
+    publishers.boolean = nt::NetworkTableInstance::GetDefault()
+                             .GetBooleanTopic(publishers.topic)
+                             .Publish();
+  }
+  publishers.boolean.Set(val);
+}
+
+void ShuffleboardLogger::PublishString(KeyId id, std::string_view val) {
+  std::lock_guard lock{m_mutex};
+  publishString(id, val);
+}
+
+void ShuffleboardLogger::publishString(KeyId id, std::string_view val) {
+  auto &publishers = m_publishers[id];
+  if (!publishers.string) {
+    releasePublishers(publishers);
+    publishers.string = nt::NetworkTableInstance::GetDefault()
+                            .GetStringTopic(publishers.topic)
+                            .Publish();
+  }
+  publishers.string.Set(val);
+}
+
+void ShuffleboardLogger::PublishPose(KeyId id, const frc::Pose2d &val) {
+  std::lock_guard lock{m_mutex};
+  if (!m_posesAsStructs) {
+    publishString(id, poseToString(val));
+    return;
+  }
+
+  auto &publishers = m_publishers[id];
+  if (!publishers.pose) {
+    releasePublishers(publishers);
+    publishers.pose = nt::NetworkTableInstance::GetDefault()
+                          .GetStructTopic<frc::Pose2d>(publishers.topic)
+                          .Publish();
+  }
+  publishers.pose.Set(val);
+}
+
+void ShuffleboardLogger::publishMessage(KeyId id, Level level,
+                                        std::string_view message) {
+  std::lock_guard lock{m_mutex};
+  m_messageBuffer.clear();
+  m_messageBuffer += levelToString(level);
+  m_messageBuffer += " - ";
+  m_messageBuffer += message;
+  publishString(id, m_messageBuffer);
+}
+
+void ShuffleboardLogger::logFormat(Level level, std::string_view key,
+                                   const std::string format, va_list ap) {
+  if (!shouldLog(level))
     return;
 
+  publishMessage(InternKey(key), level, formatString(format, ap));
+}
+
+void ShuffleboardLogger::logMessage(Level level, std::string_view key,
+                                    std::string_view message) {
+  if (!shouldLog(level))
+    return;
+
+  publishMessage(InternKey(key), level, message);
+}
+
+void ShuffleboardLogger::logVerbose(std::string key, const std::string format,
+                                    ...) {
   va_list args;
   va_start(args, format);
-  frc::SmartDashboard::PutString(
-      key, formatToShuffleboardString(Level::VERBOSE, format, args));
+  logFormat(Level::VERBOSE, key, format, args);
   va_end(args);
 }
 void ShuffleboardLogger::logInfo(std::string key, const std::string format,
                                  ...) {
-  if (!shouldLog(Level::INFO))
-    return;
-
   va_list args;
   va_start(args, format);
-  frc::SmartDashboard::PutString(
-      key, formatToShuffleboardString(Level::INFO, format, args));
+  logFormat(Level::INFO, key, format, args);
   va_end(args);
 }
 void ShuffleboardLogger::logWarning(std::string key, const std::string format,
                                     ...) {
-  if (!shouldLog(Level::WARNING))
-    return;
-
   va_list args;
   va_start(args, format);
-  frc::SmartDashboard::PutString(
-      key, formatToShuffleboardString(Level::WARNING, format, args));
+  logFormat(Level::WARNING, key, format, args);
   va_end(args);
 }
 void ShuffleboardLogger::logError(std::string key, const std::string format,
                                   ...) {
-  if (!shouldLog(Level::ERROR))
-    return;
-
   va_list args;
   va_start(args, format);
-  frc::SmartDashboard::PutString(
-      key, formatToShuffleboardString(Level::ERROR, format, args));
+  logFormat(Level::ERROR, key, format, args);
   va_end(args);
 }
 void ShuffleboardLogger::logFatal(std::string key, const std::string format,
                                   ...) {
-  if (!shouldLog(Level::FATAL))
-    return;
-
   va_list args;
   va_start(args, format);
-  frc::SmartDashboard::PutString(
-      key, formatToShuffleboardString(Level::FATAL, format, args));
+  logFormat(Level::FATAL, key, format, args);
   va_end(args);
 }
 
@@ -68,124 +154,124 @@ void ShuffleboardLogger::logInfo(std::string key, int val) {
   if (!shouldLog(Level::INFO))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 void ShuffleboardLogger::logVerbose(std::string key, int val) {
   if (!shouldLog(Level::VERBOSE))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 void ShuffleboardLogger::logWarning(std::string key, int val) {
   if (!shouldLog(Level::WARNING))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 void ShuffleboardLogger::logError(std::string key, int val) {
   if (!shouldLog(Level::ERROR))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 void ShuffleboardLogger::logFatal(std::string key, int val) {
   if (!shouldLog(Level::FATAL))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 
 void ShuffleboardLogger::logInfo(std::string key, double val) {
   if (!shouldLog(Level::INFO))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 void ShuffleboardLogger::logVerbose(std::string key, double val) {
   if (!shouldLog(Level::VERBOSE))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 void ShuffleboardLogger::logWarning(std::string key, double val) {
   if (!shouldLog(Level::WARNING))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 void ShuffleboardLogger::logError(std::string key, double val) {
   if (!shouldLog(Level::ERROR))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 void ShuffleboardLogger::logFatal(std::string key, double val) {
   if (!shouldLog(Level::FATAL))
     return;
 
-  frc::SmartDashboard::PutNumber(key, val);
+  PublishNumber(InternKey(key), val);
 }
 
 void ShuffleboardLogger::logInfo(std::string key, bool val) {
   if (!shouldLog(Level::INFO))
     return;
 
-  frc::SmartDashboard::PutBoolean(key, val);
+  PublishBoolean(InternKey(key), val);
 }
 void ShuffleboardLogger::logVerbose(std::string key, bool val) {
   if (!shouldLog(Level::VERBOSE))
     return;
 
-  frc::SmartDashboard::PutBoolean(key, val);
+  PublishBoolean(InternKey(key), val);
 }
 void ShuffleboardLogger::logWarning(std::string key, bool val) {
   if (!shouldLog(Level::WARNING))
     return;
 
-  frc::SmartDashboard::PutBoolean(key, val);
+  PublishBoolean(InternKey(key), val);
 }
 void ShuffleboardLogger::logError(std::string key, bool val) {
   if (!shouldLog(Level::ERROR))
     return;
 
-  frc::SmartDashboard::PutBoolean(key, val);
+  PublishBoolean(InternKey(key), val);
 }
 void ShuffleboardLogger::logFatal(std::string key, bool val) {
   if (!shouldLog(Level::FATAL))
     return;
 
-  frc::SmartDashboard::PutBoolean(key, val);
+  PublishBoolean(InternKey(key), val);
 }
 
 void ShuffleboardLogger::logInfo(std::string key, frc::Pose2d &val) {
   if (!shouldLog(Level::INFO))
     return;
 
-  frc::SmartDashboard::PutString(key, poseToString(val));
+  PublishPose(InternKey(key), val);
 }
 void ShuffleboardLogger::logVerbose(std::string key, frc::Pose2d &val) {
   if (!shouldLog(Level::VERBOSE))
     return;
 
-  frc::SmartDashboard::PutString(key, poseToString(val));
+  PublishPose(InternKey(key), val);
 }
 void ShuffleboardLogger::logWarning(std::string key, frc::Pose2d &val) {
   if (!shouldLog(Level::WARNING))
     return;
 
-  frc::SmartDashboard::PutString(key, poseToString(val));
+  PublishPose(InternKey(key), val);
 }
 void ShuffleboardLogger::logError(std::string key, frc::Pose2d &val) {
   if (!shouldLog(Level::ERROR))
     return;
 
-  frc::SmartDashboard::PutString(key, poseToString(val));
+  PublishPose(InternKey(key), val);
 }
 void ShuffleboardLogger::logFatal(std::string key, frc::Pose2d &val) {
   if (!shouldLog(Level::FATAL))
     return;
 
-  frc::SmartDashboard::PutString(key, poseToString(val));
+  PublishPose(InternKey(key), val);
 }
 
 void ShuffleboardLogger::logInfo(std::string key, wpi::Sendable *val) {
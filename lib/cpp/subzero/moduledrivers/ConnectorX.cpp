@@ -2,6 +2,8 @@
 
 #include <hal/I2C.h>
 
+#include "subzero/profiling/LoopProfiler.h"
+
 using namespace ConnectorX;
 
 ConnectorX::ConnectorXBoard::ConnectorXBoard(uint8_t slaveAddress,
@@ -317,85 +319,17 @@ Message ConnectorX::ConnectorXBoard::getLatestRadioMessage() {
 Commands::Response
 ConnectorX::ConnectorXBoard::sendCommand(Commands::Command command,
                                          bool expectResponse) {
+  SUBZERO_PROFILE_ZONE("ConnectorXBoard::sendCommand");
   using namespace Commands;
 
   _lastCommand = command.commandType;
-  uint8_t sendLen = 0;
-  uint8_t recSize = 0;
   Response response;
   response.commandType = command.commandType;
 
-  uint8_t sendBuf[sizeof(CommandData) + 1];
-  sendBuf[0] = static_cast<uint8_t>(command.commandType);
-
-  switch (command.commandType) {
-  case CommandType::On:
-  case CommandType::Off:
-    sendLen = 0;
-    break;
-  case CommandType::ReadConfig:
-    sendLen = 0;
-    recSize = sizeof(ResponseReadConfiguration);
-    break;
-  case CommandType::ReadPatternDone:
-    sendLen = 0;
-    recSize = sizeof(ResponsePatternDone);
-    break;
-  case CommandType::RadioGetLatestReceived:
-    sendLen = 0;
-    recSize = sizeof(ResponseRadioLastReceived);
-    break;
-  case CommandType::SetLedPort:
-    sendLen = 1;
-    break;
-  case CommandType::ReadAnalog:
-    sendLen = 1;
-    recSize = sizeof(ResponseReadAnalog);
-    break;
-  case CommandType::DigitalRead:
-    sendLen = 1;
-    recSize = sizeof(ResponseDigitalRead);
-    break;
-  case CommandType::DigitalWrite:
-    sendLen = sizeof(CommandDigitalWrite);
-    break;
-  case CommandType::DigitalSetup:
-    sendLen = sizeof(CommandDigitalSetup);
-    break;
-  case CommandType::Pattern:
-    sendLen = sizeof(CommandPattern);
-    break;
-  case CommandType::ChangeColor:
-    sendLen = sizeof(CommandColor);
-    break;
-  case CommandType::SetConfig:
-    sendLen = sizeof(CommandSetConfig);
-    break;
-  case CommandType::RadioSend:
-    sendLen = sizeof(CommandRadioSend);
-    break;
-  case CommandType::GetColor:
-    sendLen = 0;
-    break;
-  case CommandType::GetPort:
-    sendLen = 0;
-    break;
-  case CommandType::SetPatternZone:
-    sendLen = 3;
-    break;
-  case CommandType::SetNewZones:
-    sendLen =
-        sizeof(CommandSetNewZones::zoneCount) +
-        command.commandData.commandSetNewZones.zoneCount * sizeof(NewZone);
-    break;
-  case CommandType::SyncStates:
-    sendLen =
-        sizeof(CommandSyncZoneStates::zoneCount) +
-        command.commandData.commandSyncZoneStates.zoneCount * sizeof(uint8_t);
-    break;
-  }
-
-  memcpy(sendBuf + 1, &command.commandData, sendLen);
+  EncodedCommand encoded = Encode(command);
+  uint8_t *sendBuf = encoded.data;
+  uint8_t sendLen = encoded.length - 1;
+  uint8_t recSize = encoded.responseSize;
 
   std::ostringstream stream;
   for (uint8_t i = 0; i < sendLen + 1; i++) {
@@ -0,0 +1,119 @@
+#include "subzero/motor/MotorSensorRegistry.h"
+
+#include <frc/Timer.h>
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+
+MotorSensorRegistry::Handle
+MotorSensorRegistry::Register(IPidMotorController *controller) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  // Reuse a freed slot so registering and unregistering in a loop, as the
+  // simulation harness does per case, doesn't grow the snapshot
+  if (!m_freeHandles.empty()) {
+    Handle handle = m_freeHandles.back();
+    m_freeHandles.pop_back();
+    m_controllers[handle] = controller;
+    return handle;
+  }
+
+  m_controllers.push_back(controller);
+  m_positions.push_back(0);
+  m_absolutePositions.push_back(0);
+  m_hasAbsolutePosition.push_back(false);
+  m_velocities.push_back(0);
+  m_currents.push_back(0);
+  m_temperatures.push_back(0);
+  m_sampled.push_back(false);
+
+  return m_controllers.size() - 1;
+}
+
+void MotorSensorRegistry::Unregister(Handle handle) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (handle < m_controllers.size() && m_controllers[handle]) {
+    m_controllers[handle] = nullptr;
+    m_sampled[handle] = false;
+    m_freeHandles.push_back(handle);
+  }
+}
+
+void MotorSensorRegistry::Refresh() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  m_timestamp = frc::Timer::GetFPGATimestamp();
+  for (size_t i = 0; i < m_controllers.size(); i++) {
+    ReadController(i);
+  }
+
+  m_hasSnapshot = true;
+  m_staleLogged = false;
+}
+
+void MotorSensorRegistry::Refresh(Handle handle) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (handle < m_sampled.size() && m_sampled[handle]) {
+    ReadController(handle);
+  }
+}
+
+std::optional<MotorSensorSample> MotorSensorRegistry::GetSample(Handle handle) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  if (!m_hasSnapshot || handle >= m_sampled.size() || !m_sampled[handle]) {
+    return std::nullopt;
+  }
+
+  // Refresh() stopped being called, e.g. it only runs in one mode's periodic;
+  // callers read the controller instead of trusting a frozen snapshot
+  if (frc::Timer::GetFPGATimestamp() - m_timestamp > kMaxSnapshotAge) {
+    if (!m_staleLogged) {
+      ConsoleWriter.logWarning(
+          "MotorSensorRegistry",
+          "Snapshot is older than %.0f ms; reading controllers directly. Call "
+          "Refresh() at the top of RobotPeriodic",
+          units::millisecond_t(kMaxSnapshotAge).value());
+      m_staleLogged = true;
+    }
+    return std::nullopt;
+  }
+
+  return MotorSensorSample{
+      .position = m_positions[handle],
+      .absolutePosition =
+          m_hasAbsolutePosition[handle]
+              ? std::optional<double>(m_absolutePositions[handle])
+              : std::nullopt,
+      .velocity = m_velocities[handle],
+      .current = units::ampere_t(m_currents[handle]),
+      .temperature = units::celsius_t(m_temperatures[handle]),
+      .timestamp = m_timestamp,
+  };
+}
+
+bool MotorSensorRegistry::HasSnapshot() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  return m_hasSnapshot;
+}
+
+void MotorSensorRegistry::ReadController(size_t index) {
+  IPidMotorController *controller = m_controllers[index];
+  if (!controller) {
+    return;
+  }
+
+  auto absolutePosition = controller->GetAbsoluteEncoderPosition();
+
+  m_positions[index] = controller->GetEncoderPosition();
+  m_absolutePositions[index] = absolutePosition.value_or(0);
+  m_hasAbsolutePosition[index] = absolutePosition.has_value();
+  m_velocities[index] = controller->GetEncoderVelocity();
+  m_currents[index] = controller->GetOutputCurrent().value();
+  m_temperatures[index] = controller->GetMotorTemperature().value();
+  m_sampled[index] = true;
+}
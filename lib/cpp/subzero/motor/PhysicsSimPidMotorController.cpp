@@ -0,0 +1,196 @@
+#include "subzero/motor/PhysicsSimPidMotorController.h"
+
+#include <cmath>
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+
+PhysicsSimPidMotorController::PhysicsSimPidMotorController(
+    std::string name, PidSettings pidSettings, PhysicsSimConfig config,
+    std::function<units::second_t()> timeSource)
+    : IPidMotorController(name), m_settings{pidSettings}, m_config{config},
+      m_timeSource{timeSource},
+      m_pidController{
+          frc::PIDController{pidSettings.p, pidSettings.i, pidSettings.d}},
+      m_rng{config.seed},
+      // The distribution requires a positive deviation even when unused
+      m_noise{0.0, config.positionNoiseStdDev > 0 ? config.positionNoiseStdDev
+                                                  : 1.0} {}
+
+void PhysicsSimPidMotorController::Set(units::volt_t volts) {
+  m_mode = ControlMode::kVoltage;
+  m_appliedVoltage = ClampVoltage(volts);
+}
+
+void PhysicsSimPidMotorController::Update() {
+  if (m_mode == ControlMode::kPosition) {
+    auto effort =
+        m_pidController.Calculate(GetEncoderPosition(), m_positionTarget);
+    m_appliedVoltage = ClampVoltage(units::volt_t(effort) + m_feedforward);
+
+    if (!m_tracking && m_pidController.AtSetpoint()) {
+      m_pidController.Reset();
+      Stop();
+    }
+  }
+
+  units::second_t now = m_timeSource();
+  if (m_lastTime) {
+    Advance(now - m_lastTime.value());
+  }
+  m_lastTime = now;
+}
+
+void PhysicsSimPidMotorController::RunWithVelocity(
+    units::revolutions_per_minute_t rpm) {
+  m_mode = ControlMode::kVelocity;
+  // Velocities are given in converted units per minute, like the real
+  // controller, so they have to be turned back into motor revolutions
+  m_velocityTarget =
+      units::revolutions_per_minute_t(rpm.value() / m_conversionFactor);
+}
+
+void PhysicsSimPidMotorController::RunWithVelocity(double percentage) {
+  if (std::abs(percentage) > 1.0) {
+    ConsoleWriter.logError("PhysicsSimPidMotorController",
+                           "Incorrect percentages for motor %s: Value=%.4f ",
+                           m_name.c_str(), percentage);
+    return;
+  }
+
+  m_mode = ControlMode::kVelocity;
+  m_velocityTarget = m_config.motor.freeSpeed * percentage;
+}
+
+void PhysicsSimPidMotorController::RunToPosition(double position) {
+  Stop();
+  m_pidController.Reset();
+  m_mode = ControlMode::kPosition;
+  m_positionTarget = position;
+}
+
+void PhysicsSimPidMotorController::TrackPosition(double position,
+                                                 units::volt_t feedforward) {
+  if (m_mode != ControlMode::kPosition || !m_tracking) {
+    m_pidController.Reset();
+  }
+
+  m_mode = ControlMode::kPosition;
+  m_tracking = true;
+  m_positionTarget = position;
+  m_feedforward = feedforward;
+}
+
+double PhysicsSimPidMotorController::GetEncoderPosition() {
+  double position =
+      (GetMotorRotations() - m_encoderOffset) * m_conversionFactor;
+
+  if (m_config.positionNoiseStdDev > 0) {
+    position += m_noise(m_rng);
+  }
+
+  return position;
+}
+
+double PhysicsSimPidMotorController::GetEncoderVelocity() {
+  return m_outputVelocity.value() * m_config.gearing /
+         (2 * std::numbers::pi) * m_conversionFactor;
+}
+
+void PhysicsSimPidMotorController::Stop() {
+  m_mode = ControlMode::kStopped;
+  m_appliedVoltage = 0_V;
+  m_tracking = false;
+  m_feedforward = 0_V;
+}
+
+void PhysicsSimPidMotorController::UpdatePidSettings(PidSettings settings) {
+  m_settings = settings;
+  m_pidController.SetPID(settings.p, settings.i, settings.d);
+}
+
+void PhysicsSimPidMotorController::Simulate(units::second_t duration) {
+  Advance(duration);
+}
+
+void PhysicsSimPidMotorController::SetMechanismPosition(double position) {
+  m_outputAngle = units::radian_t(position / m_conversionFactor /
+                                  m_config.gearing * 2 * std::numbers::pi);
+  m_outputVelocity = 0_rad_per_s;
+  m_encoderOffset = 0;
+}
+
+void PhysicsSimPidMotorController::Advance(units::second_t elapsed) {
+  m_accumulatedTime += elapsed;
+
+  // The epsilon keeps e.g. 20 ms from turning into 19 steps of 1 ms because
+  // of rounding
+  int steps = static_cast<int>(
+      std::floor((m_accumulatedTime / m_config.subStep).value() + 1e-9));
+  for (int i = 0; i < steps; i++) {
+    Step(m_config.subStep);
+  }
+
+  m_accumulatedTime -= m_config.subStep * steps;
+}
+
+void PhysicsSimPidMotorController::Step(units::second_t dt) {
+  units::radians_per_second_t motorSpeed = m_outputVelocity * m_config.gearing;
+  units::volt_t voltage = m_appliedVoltage;
+
+  if (m_mode == ControlMode::kVelocity) {
+    // The motor controller closes this loop at a much higher rate than the
+    // robot loop, so it's evaluated every sub-step
+    double errorNative = units::revolutions_per_minute_t(
+                             m_velocityTarget - motorSpeed)
+                             .value() *
+                         m_conversionFactor;
+    voltage = ClampVoltage(
+        m_config.motor.Voltage(0_Nm, m_velocityTarget) +
+        m_config.supplyVoltage * (m_settings.p * errorNative));
+    m_appliedVoltage = voltage;
+  }
+
+  bool coasting =
+      m_mode == ControlMode::kStopped && !m_settings.isIdleModeBrake;
+  m_current = coasting ? 0_A : m_config.motor.Current(motorSpeed, voltage);
+
+  units::newton_meter_t netTorque =
+      m_config.motor.Torque(m_current) * m_config.gearing -
+      units::newton_meter_t(m_config.viscousFriction *
+                            m_outputVelocity.value());
+  if (m_config.gravityTorque) {
+    netTorque -= m_config.gravityTorque.value()(GetMechanismPosition());
+  }
+
+  if (m_outputVelocity == 0_rad_per_s) {
+    // Stiction holds the mechanism until it's overcome
+    if (units::math::abs(netTorque) <= m_config.staticFriction) {
+      return;
+    }
+    netTorque -= netTorque > 0_Nm ? m_config.staticFriction
+                                  : -m_config.staticFriction;
+  } else {
+    netTorque -= m_outputVelocity > 0_rad_per_s ? m_config.staticFriction
+                                                : -m_config.staticFriction;
+  }
+
+  double acceleration = netTorque.value() / m_config.loadMoi.value();
+  units::radians_per_second_t newVelocity =
+      m_outputVelocity + units::radians_per_second_t(acceleration * dt.value());
+
+  // Stop at the zero crossing so stiction gets a chance to hold
+  if (m_outputVelocity.value() * newVelocity.value() < 0) {
+    newVelocity = 0_rad_per_s;
+  }
+
+  m_outputVelocity = newVelocity;
+  m_outputAngle += m_outputVelocity * dt;
+}
+
+units::volt_t
+PhysicsSimPidMotorController::ClampVoltage(units::volt_t volts) const {
+  return units::math::min(
+      units::math::max(volts, -m_config.supplyVoltage), m_config.supplyVoltage);
+}
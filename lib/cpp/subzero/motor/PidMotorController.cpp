@@ -2,6 +2,8 @@
 
 #include "subzero/motor/PidMotorController.h"
 
+#include "subzero/profiling/LoopProfiler.h"
+
 using namespace subzero;
 
 template <typename TMotor, typename TController, typename TRelativeEncoder,
@@ -50,6 +52,8 @@ template <typename TMotor, typename TController, typename TRelativeEncoder,
           typename TAbsoluteEncoder, typename TPidConfig>
 void PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
                         TPidConfig>::Update() {
+  SUBZERO_PROFILE_ZONE("PidMotorController::Update");
+
   if (m_absolutePositionEnabled) {
     // ConsoleWriter.logVerbose(
     //     m_name,
@@ -59,10 +63,10 @@ void PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
     //     m_absoluteTarget);
     auto effort =
         m_pidController.Calculate(GetEncoderPosition(), m_absoluteTarget);
-    double totalEffort = effort;
+    double totalEffort = effort + m_feedforward.value();
     Set(units::volt_t(totalEffort));
 
-    if (m_pidController.AtSetpoint()) {
+    if (!m_tracking && m_pidController.AtSetpoint()) {
       m_pidController.Reset();
       m_absolutePositionEnabled = false;
       Stop();
@@ -95,17 +99,71 @@ void PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
   RunWithVelocity(rpm);
 }
 
+template <typename TMotor, typename TController, typename TRelativeEncoder,
+          typename TAbsoluteEncoder, typename TPidConfig>
+void PidMotorController<
+    TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
+    TPidConfig>::RunWithVelocity(units::revolutions_per_minute_t rpm,
+                                 units::volt_t arbFeedforward) {
+  m_absolutePositionEnabled = false;
+  m_controller.SetReference(rpm.value(),
+                            rev::spark::SparkLowLevel::ControlType::kVelocity,
+                            rev::spark::ClosedLoopSlot::kSlot0,
+                            arbFeedforward.value());
+}
+
+template <typename TMotor, typename TController, typename TRelativeEncoder,
+          typename TAbsoluteEncoder, typename TPidConfig>
+void PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
+                        TPidConfig>::Follow(PidMotorController &leader,
+                                            bool inverted) {
+  ConsoleWriter.logInfo("PidMotorController", "%s following %s%s",
+                        m_name.c_str(), leader.m_name.c_str(),
+                        inverted ? " (inverted)" : "");
+  m_absolutePositionEnabled = false;
+  m_config.Follow(leader.m_motor, inverted);
+  m_motor.Configure(m_config,
+                    rev::spark::SparkBase::ResetMode::kNoResetSafeParameters,
+                    rev::spark::SparkBase::PersistMode::kPersistParameters);
+}
+
+template <typename TMotor, typename TController, typename TRelativeEncoder,
+          typename TAbsoluteEncoder, typename TPidConfig>
+void PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
+                        TPidConfig>::StopFollowing() {
+  m_config.DisableFollowerMode();
+  m_motor.Configure(m_config,
+                    rev::spark::SparkBase::ResetMode::kNoResetSafeParameters,
+                    rev::spark::SparkBase::PersistMode::kPersistParameters);
+}
+
 template <typename TMotor, typename TController, typename TRelativeEncoder,
           typename TAbsoluteEncoder, typename TPidConfig>
 void PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
                         TPidConfig>::RunToPosition(double position) {
-  ConsoleWriter.logVerbose(m_name + " Target position", position);
+  SUBZERO_LOG_VERBOSE(ConsoleWriter, m_name + " Target position", "{:.3f}",
+                      position);
   Stop();
   m_pidController.Reset();
   m_absolutePositionEnabled = true;
   m_absoluteTarget = position;
 }
 
+template <typename TMotor, typename TController, typename TRelativeEncoder,
+          typename TAbsoluteEncoder, typename TPidConfig>
+void PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
+                        TPidConfig>::TrackPosition(double position,
+                                                   units::volt_t feedforward) {
+  if (!m_absolutePositionEnabled || !m_tracking) {
+    m_pidController.Reset();
+  }
+
+  m_absolutePositionEnabled = true;
+  m_tracking = true;
+  m_absoluteTarget = position;
+  m_feedforward = feedforward;
+}
+
 template <typename TMotor, typename TController, typename TRelativeEncoder,
           typename TAbsoluteEncoder, typename TPidConfig>
 std::optional<double>
@@ -123,6 +181,8 @@ template <typename TMotor, typename TController, typename TRelativeEncoder,
 void PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder,
                         TPidConfig>::Stop() {
   m_absolutePositionEnabled = false;
+  m_tracking = false;
+  m_feedforward = 0_V;
   m_motor.Set(0);
 }
 
@@ -0,0 +1,245 @@
+#include "subzero/motor/PidMotorControllerCharacterizer.h"
+
+#include <frc/EigenCore.h>
+#include <frc/controller/LinearQuadraticRegulator.h>
+#include <frc/smartdashboard/SmartDashboard.h>
+#include <frc2/command/FunctionalCommand.h>
+#include <frc2/command/InstantCommand.h>
+#include <frc2/command/WaitCommand.h>
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <cmath>
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+
+// Spark velocity loops are in converted units per minute and output duty cycle
+constexpr double kNativeVelocityScale = 60.0 * 12.0;
+// Samples slower than this are in the stiction band and skew the fit
+constexpr double kMinimumFitVelocity = 1e-3;
+
+PidMotorControllerCharacterizer::PidMotorControllerCharacterizer(
+    IPidMotorController &controller, frc2::Subsystem &subsystem,
+    CharacterizationConfig config)
+    : m_controller{controller}, m_subsystem{subsystem}, m_config{config} {
+  m_samples.reserve(m_config.bufferCapacity);
+}
+
+frc2::CommandPtr
+PidMotorControllerCharacterizer::Quasistatic(Direction direction) {
+  return RunTest(true, direction);
+}
+
+frc2::CommandPtr PidMotorControllerCharacterizer::Dynamic(Direction direction) {
+  return RunTest(false, direction);
+}
+
+frc2::CommandPtr PidMotorControllerCharacterizer::FullRoutine() {
+  return frc2::InstantCommand([this] { ClearSamples(); })
+      .ToPtr()
+      .AndThen(Quasistatic(Direction::kForward))
+      .AndThen(frc2::WaitCommand(1_s).ToPtr())
+      .AndThen(Quasistatic(Direction::kReverse))
+      .AndThen(frc2::WaitCommand(1_s).ToPtr())
+      .AndThen(Dynamic(Direction::kForward))
+      .AndThen(frc2::WaitCommand(1_s).ToPtr())
+      .AndThen(Dynamic(Direction::kReverse))
+      .AndThen(frc2::InstantCommand([this] { Publish(Analyze()); }).ToPtr());
+}
+
+PidMotorControllerCharacterizer::CharacterizationResult
+PidMotorControllerCharacterizer::Analyze() {
+  CharacterizationResult result{
+      .valid = false,
+      .kS = 0,
+      .kV = 0,
+      .kA = 0,
+      .kG = 0,
+      .rSquared = 0,
+      .sampleCount = 0,
+      .positionSettings = m_controller.GetPidSettings(),
+      .velocitySettings = m_controller.GetPidSettings(),
+  };
+
+  bool hasGravity = m_config.mechanismType != MechanismType::kSimple;
+  int columns = hasGravity ? 4 : 3;
+
+  // Acceleration comes from a central difference, so the first and last
+  // sample of each test can't be used
+  std::vector<size_t> rows;
+  rows.reserve(m_samples.size());
+  for (size_t i = 1; i + 1 < m_samples.size(); i++) {
+    if (m_samples[i - 1].test == m_samples[i].test &&
+        m_samples[i + 1].test == m_samples[i].test &&
+        std::abs(m_samples[i].velocity) > kMinimumFitVelocity) {
+      rows.push_back(i);
+    }
+  }
+
+  result.sampleCount = rows.size();
+  if (rows.size() < static_cast<size_t>(columns) * 2) {
+    ConsoleWriter.logWarning(m_controller.m_name + " Characterization",
+                             "Not enough samples to fit (%d)",
+                             static_cast<int>(rows.size()));
+    return result;
+  }
+
+  Eigen::MatrixXd x(rows.size(), columns);
+  Eigen::VectorXd y(rows.size());
+  for (size_t row = 0; row < rows.size(); row++) {
+    const Sample &prev = m_samples[rows[row] - 1];
+    const Sample &cur = m_samples[rows[row]];
+    const Sample &next = m_samples[rows[row] + 1];
+
+    double acceleration =
+        (next.velocity - prev.velocity) / (next.timestamp - prev.timestamp);
+
+    x(row, 0) = std::copysign(1.0, cur.velocity);
+    x(row, 1) = cur.velocity;
+    x(row, 2) = acceleration;
+    if (m_config.mechanismType == MechanismType::kElevator) {
+      x(row, 3) = 1.0;
+    } else if (m_config.mechanismType == MechanismType::kArm) {
+      x(row, 3) = std::cos((cur.position - m_config.armHorizontalPosition) *
+                           m_config.armPositionToRadians);
+    }
+    y(row) = cur.voltage;
+  }
+
+  Eigen::VectorXd beta = x.colPivHouseholderQr().solve(y);
+  Eigen::VectorXd residuals = y - x * beta;
+  double totalSumOfSquares = (y.array() - y.mean()).square().sum();
+
+  result.valid = true;
+  result.kS = beta(0);
+  result.kV = beta(1);
+  result.kA = beta(2);
+  result.kG = hasGravity ? beta(3) : 0;
+  result.rSquared = totalSumOfSquares > 0
+                        ? 1 - residuals.squaredNorm() / totalSumOfSquares
+                        : 0;
+
+  RecommendGains(result);
+
+  return result;
+}
+
+void PidMotorControllerCharacterizer::ClearSamples() {
+  m_samples.clear();
+  m_testIndex = 0;
+}
+
+frc2::CommandPtr
+PidMotorControllerCharacterizer::RunTest(bool quasistatic,
+                                         Direction direction) {
+  double sign = direction == Direction::kForward ? 1.0 : -1.0;
+
+  return frc2::FunctionalCommand(
+             // OnInit
+             [this] {
+               m_testIndex++;
+               m_timer.Restart();
+             },
+             // OnExecute
+             [this, quasistatic, sign] {
+               units::volt_t volts =
+                   sign *
+                   (quasistatic ? units::volt_t(m_config.quasistaticRampRate *
+                                                m_timer.Get())
+                                : m_config.dynamicStepVoltage);
+               m_controller.Set(volts);
+
+               if (m_samples.size() < m_samples.capacity()) {
+                 m_samples.push_back(
+                     {.voltage = volts.value(),
+                      .position = m_controller.GetEncoderPosition(),
+                      .velocity = m_controller.GetEncoderVelocity(),
+                      .timestamp = frc::Timer::GetFPGATimestamp().value(),
+                      .test = m_testIndex});
+               }
+             },
+             // OnEnd
+             [this](bool interrupted) { m_controller.Stop(); },
+             // IsFinished
+             [this, direction] {
+               return m_timer.HasElapsed(m_config.testTimeout) ||
+                      m_samples.size() >= m_samples.capacity() ||
+                      (m_config.isAtLimit &&
+                       m_config.isAtLimit.value()(direction));
+             },
+             {&m_subsystem})
+      .ToPtr();
+}
+
+void PidMotorControllerCharacterizer::RecommendGains(
+    CharacterizationResult &result) {
+  double maxEffort = m_config.maxControlEffort.value();
+
+  result.positionSettings.i = 0;
+  result.positionSettings.iZone = 0;
+  result.positionSettings.ff = 0;
+  result.velocitySettings.i = 0;
+  result.velocitySettings.iZone = 0;
+  result.velocitySettings.ff = result.kV / kNativeVelocityScale;
+
+  if (result.kV <= 0 || result.kA <= 0) {
+    // Without a usable model, fall back to saturating at the max error
+    result.positionSettings.p = maxEffort / m_config.maxPositionError;
+    result.positionSettings.d = 0;
+    result.velocitySettings.p =
+        maxEffort / m_config.maxVelocityError / kNativeVelocityScale;
+    result.velocitySettings.d = 0;
+    return;
+  }
+
+  try {
+    frc::Matrixd<2, 2> positionA{{0, 1}, {0, -result.kV / result.kA}};
+    frc::Matrixd<2, 1> positionB{{0}, {1 / result.kA}};
+    frc::LinearQuadraticRegulator<2, 1> positionLqr{
+        positionA,
+        positionB,
+        {m_config.maxPositionError, m_config.maxVelocityError},
+        {maxEffort},
+        20_ms};
+    result.positionSettings.p = positionLqr.K(0, 0);
+    result.positionSettings.d = positionLqr.K(0, 1);
+
+    frc::Matrixd<1, 1> velocityA{{-result.kV / result.kA}};
+    frc::Matrixd<1, 1> velocityB{{1 / result.kA}};
+    frc::LinearQuadraticRegulator<1, 1> velocityLqr{
+        velocityA, velocityB, {m_config.maxVelocityError}, {maxEffort}, 1_ms};
+    result.velocitySettings.p = velocityLqr.K(0, 0) / kNativeVelocityScale;
+    result.velocitySettings.d = 0;
+  } catch (const std::exception &e) {
+    ConsoleWriter.logError(m_controller.m_name + " Characterization",
+                           "Could not compute gains: %s", e.what());
+  }
+}
+
+void PidMotorControllerCharacterizer::Publish(
+    const CharacterizationResult &result) {
+  std::string prefix = m_controller.m_name + " Characterization";
+
+  frc::SmartDashboard::PutBoolean(prefix + " Valid", result.valid);
+  frc::SmartDashboard::PutNumber(prefix + " kS", result.kS);
+  frc::SmartDashboard::PutNumber(prefix + " kV", result.kV);
+  frc::SmartDashboard::PutNumber(prefix + " kA", result.kA);
+  frc::SmartDashboard::PutNumber(prefix + " kG", result.kG);
+  frc::SmartDashboard::PutNumber(prefix + " R^2", result.rSquared);
+  frc::SmartDashboard::PutNumber(prefix + " Position P",
+                                 result.positionSettings.p);
+  frc::SmartDashboard::PutNumber(prefix + " Position D",
+                                 result.positionSettings.d);
+  frc::SmartDashboard::PutNumber(prefix + " Velocity P",
+                                 result.velocitySettings.p);
+  frc::SmartDashboard::PutNumber(prefix + " Velocity FF",
+                                 result.velocitySettings.ff);
+
+  ConsoleWriter.logInfo(prefix,
+                        "kS=%.5f kV=%.5f kA=%.5f kG=%.5f R^2=%.4f from %d "
+                        "samples",
+                        result.kS, result.kV, result.kA, result.kG,
+                        result.rSquared, static_cast<int>(result.sampleCount));
+}
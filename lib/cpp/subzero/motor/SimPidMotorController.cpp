@@ -24,10 +24,10 @@ void SimPidMotorController::Update() {
     //     m_absoluteTarget);
     auto effort =
         m_pidController.Calculate(GetEncoderPosition(), m_absoluteTarget);
-    double totalEffort = effort;
+    double totalEffort = effort + m_feedforward.value();
     Set(units::volt_t(totalEffort));
 
-    if (m_pidController.AtSetpoint()) {
+    if (!m_tracking && m_pidController.AtSetpoint()) {
       m_pidController.Reset();
       m_absolutePositionEnabled = false;
       Stop();
@@ -45,7 +45,21 @@ void SimPidMotorController::RunToPosition(double position) {
   m_absoluteTarget = position;
 }
 
+void SimPidMotorController::TrackPosition(double position,
+                                          units::volt_t feedforward) {
+  if (!m_absolutePositionEnabled || !m_tracking) {
+    m_pidController.Reset();
+  }
+
+  m_absolutePositionEnabled = true;
+  m_tracking = true;
+  m_absoluteTarget = position;
+  m_feedforward = feedforward;
+}
+
 void SimPidMotorController::Stop() {
   m_absolutePositionEnabled = false;
+  m_tracking = false;
+  m_feedforward = 0_V;
   Set(0);
 }
\ No newline at end of file
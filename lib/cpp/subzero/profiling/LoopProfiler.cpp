@@ -0,0 +1,170 @@
+#include "subzero/profiling/LoopProfiler.h"
+
+#include <frc/Timer.h>
+#include <networktables/NetworkTableInstance.h>
+
+#include <algorithm>
+#include <bit>
+#include <string>
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+
+constexpr units::second_t kPublishPeriod = 1_s;
+
+void ProfileZone::Record(uint64_t nanoseconds) {
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_total.fetch_add(nanoseconds, std::memory_order_relaxed);
+  m_histogram[BucketFor(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+
+  uint64_t min = m_min.load(std::memory_order_relaxed);
+  while (nanoseconds < min &&
+         !m_min.compare_exchange_weak(min, nanoseconds,
+                                      std::memory_order_relaxed)) {
+  }
+  uint64_t max = m_max.load(std::memory_order_relaxed);
+  while (nanoseconds > max &&
+         !m_max.compare_exchange_weak(max, nanoseconds,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+ProfileZone::Stats ProfileZone::TakeStats() {
+  // Timings recorded while this runs may land in either window; that's fine
+  // for a once-per-second summary
+  uint64_t count = m_count.exchange(0, std::memory_order_relaxed);
+  uint64_t total = m_total.exchange(0, std::memory_order_relaxed);
+  uint64_t min = m_min.exchange(UINT64_MAX, std::memory_order_relaxed);
+  uint64_t max = m_max.exchange(0, std::memory_order_relaxed);
+
+  std::array<uint32_t, kBuckets> histogram;
+  uint64_t histogramCount = 0;
+  for (size_t i = 0; i < kBuckets; i++) {
+    histogram[i] = m_histogram[i].exchange(0, std::memory_order_relaxed);
+    histogramCount += histogram[i];
+  }
+
+  if (count == 0) {
+    return {0, 0, 0, 0, 0};
+  }
+
+  uint64_t p99 = max;
+  uint64_t p99Rank = (histogramCount * 99 + 99) / 100;
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBuckets; i++) {
+    seen += histogram[i];
+    if (seen >= p99Rank) {
+      p99 = std::min(BucketUpperBound(i), max);
+      break;
+    }
+  }
+
+  constexpr double kNsPerMs = 1e6;
+  return {count, min / kNsPerMs, total / kNsPerMs / count, p99 / kNsPerMs,
+          max / kNsPerMs};
+}
+
+size_t ProfileZone::BucketFor(uint64_t nanoseconds) {
+  if (nanoseconds < 4) {
+    return nanoseconds;
+  }
+
+  // The power of 2, then the next two bits below it
+  int msb = std::bit_width(nanoseconds) - 1;
+  size_t subBucket = (nanoseconds >> (msb - 2)) & 3;
+  return std::min((msb - 1) * 4 + subBucket, kBuckets - 1);
+}
+
+uint64_t ProfileZone::BucketUpperBound(size_t bucket) {
+  if (bucket < 4) {
+    return bucket + 1;
+  }
+
+  int msb = bucket / 4 + 1;
+  uint64_t subBucket = bucket % 4;
+  return (5 + subBucket) << (msb - 2);
+}
+
+ProfileZone *LoopProfiler::RegisterZone(std::string_view name) {
+  std::scoped_lock lock{m_registerMutex};
+
+  size_t count = m_zoneCount;
+  std::optional<size_t> freeSlot;
+  for (size_t i = 0; i < count; i++) {
+    if (m_refCounts[i] == 0) {
+      if (!freeSlot) {
+        freeSlot = i;
+      }
+    } else if (m_zones[i].name == name) {
+      // Template code registers the same name once per instantiation
+      m_refCounts[i]++;
+      return &m_zones[i];
+    }
+  }
+
+  if (!freeSlot && count == kMaxZones) {
+    if (!m_loggedFull) {
+      ConsoleWriter.logWarning(
+          "LoopProfiler",
+          "All %zu zones are in use; %s and later zones aren't timed",
+          kMaxZones, std::string{name}.c_str());
+      m_loggedFull = true;
+    }
+    return nullptr;
+  }
+
+  size_t slot = freeSlot.value_or(count);
+  const std::string &storedName = *m_names.emplace(name).first;
+  // Drop anything a released zone recorded in this slot
+  m_zones[slot].TakeStats();
+  m_zones[slot].name = storedName.c_str();
+  m_publishers[slot] = nt::NetworkTableInstance::GetDefault()
+                           .GetDoubleArrayTopic("/Profiler/" + storedName)
+                           .Publish();
+  m_refCounts[slot] = 1;
+  if (slot == count) {
+    m_zoneCount++;
+  }
+  return &m_zones[slot];
+}
+
+void LoopProfiler::ReleaseZone(ProfileZone *zone) {
+  if (!zone) {
+    return;
+  }
+
+  std::scoped_lock lock{m_registerMutex};
+
+  size_t slot = zone - m_zones.data();
+  if (slot >= kMaxZones || m_refCounts[slot] == 0 ||
+      --m_refCounts[slot] > 0) {
+    return;
+  }
+
+  m_publishers[slot] = {};
+  m_loggedFull = false;
+}
+
+void LoopProfiler::Periodic() {
+  units::second_t now = frc::Timer::GetFPGATimestamp();
+  if (m_lastPublishTime && now - *m_lastPublishTime < kPublishPeriod) {
+    return;
+  }
+  m_lastPublishTime = now;
+
+  std::scoped_lock lock{m_registerMutex};
+
+  size_t count = m_zoneCount;
+  for (size_t i = 0; i < count; i++) {
+    if (m_refCounts[i] == 0) {
+      continue;
+    }
+
+    ProfileZone::Stats stats = m_zones[i].TakeStats();
+    std::array<double, 5> values{static_cast<double>(stats.count),
+                                 stats.minMs, stats.meanMs, stats.p99Ms,
+                                 stats.maxMs};
+    m_publishers[i].Set(values);
+  }
+}
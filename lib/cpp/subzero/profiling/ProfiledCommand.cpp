@@ -0,0 +1,34 @@
+#include "subzero/profiling/ProfiledCommand.h"
+
+#include <string>
+#include <utility>
+
+using namespace subzero;
+
+ProfiledCommand::ProfiledCommand(std::unique_ptr<frc2::Command> &&command)
+    : CommandHelper{std::move(command)} {}
+
+ProfiledCommand::ProfiledCommand(ProfiledCommand &&other)
+    : CommandHelper{std::move(other)},
+      m_zone{std::exchange(other.m_zone, nullptr)} {}
+
+ProfiledCommand::~ProfiledCommand() {
+  LoopProfiler::getInstance().ReleaseZone(m_zone);
+}
+
+void ProfiledCommand::Initialize() {
+  if (!m_zone) {
+    m_zone = LoopProfiler::getInstance().RegisterZone("Command/" +
+                                                      std::string{GetName()});
+  }
+  WrapperCommand::Initialize();
+}
+
+void ProfiledCommand::Execute() {
+  SUBZERO_PROFILE_SCOPE(m_zone);
+  WrapperCommand::Execute();
+}
+
+frc2::CommandPtr ProfiledCommand::Profiled(frc2::CommandPtr &&command) {
+  return ProfiledCommand{std::move(command).Unwrap()}.ToPtr();
+}
@@ -0,0 +1,210 @@
+#include "subzero/profiling/TraceRecorder.h"
+
+#include <fmt/format.h>
+#include <frc/RobotBase.h>
+
+#include <filesystem>
+#include <iterator>
+#include <string_view>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+
+// How often the writer moves events to disk
+constexpr auto kWritePeriod = std::chrono::milliseconds(100);
+
+namespace {
+// Zone and thread names come from runtime subsystem, command and thread names,
+// so a quote or backslash in one mustn't break the file
+void AppendJsonEscaped(std::string &out, std::string_view text) {
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      fmt::format_to(std::back_inserter(out), "\\u{:04x}",
+                     static_cast<unsigned char>(c));
+    } else {
+      out += c;
+    }
+  }
+}
+} // namespace
+
+TraceRecorder::~TraceRecorder() { Stop(); }
+
+bool TraceRecorder::Start(std::string directory) {
+  if (IsRecording()) {
+    return false;
+  }
+
+  if (directory.empty()) {
+    directory = frc::RobotBase::IsReal() ? "/u" : ".";
+  }
+
+  auto now = std::chrono::system_clock::now().time_since_epoch();
+  auto path = std::filesystem::path{directory} /
+              fmt::format("trace_{}.json",
+                          std::chrono::duration_cast<std::chrono::seconds>(now)
+                              .count());
+
+  m_file.open(path);
+  if (!m_file) {
+    ConsoleWriter.logError("TraceRecorder", "Unable to open %s",
+                           path.c_str());
+    return false;
+  }
+
+  // The JSON array format; viewers accept a trace without the closing bracket
+  // if the robot loses power mid-match
+  m_file << "[\n";
+  m_startTime = std::chrono::steady_clock::now();
+  m_dropped = 0;
+
+  {
+    // Discard events left over from an earlier recording, and name every
+    // thread again in the new file
+    std::scoped_lock lock{m_buffersMutex};
+    for (auto &buffer : m_buffers) {
+      buffer->tail.store(buffer->head.load(std::memory_order_acquire),
+                         std::memory_order_release);
+      buffer->namePending = true;
+    }
+  }
+
+  m_recording = true;
+  m_writer = std::thread([this] { Run(); });
+  ConsoleWriter.logInfo("TraceRecorder", "Recording to %s", path.c_str());
+  return true;
+}
+
+void TraceRecorder::Stop() {
+  if (!IsRecording()) {
+    return;
+  }
+
+  m_recording = false;
+  if (m_writer.joinable()) {
+    m_writer.join();
+  }
+
+  // Metadata event so the array doesn't end with a trailing comma
+  m_file << fmt::format(
+      "{{\"name\":\"dropped_events\",\"ph\":\"M\",\"pid\":1,"
+      "\"args\":{{\"count\":{}}}}}\n]\n",
+      GetDroppedCount());
+  m_file.close();
+}
+
+void TraceRecorder::Record(const char *name,
+                           std::chrono::steady_clock::time_point start,
+                           std::chrono::steady_clock::time_point end) {
+  ThreadBuffer &buffer = GetThreadBuffer();
+
+  size_t head = buffer.head.load(std::memory_order_relaxed);
+  if (head - buffer.tail.load(std::memory_order_acquire) >= kThreadBufferSize) {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  buffer.events[head % kThreadBufferSize] = {name, start, end};
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void TraceRecorder::SetThreadName(std::string name) {
+  ThreadBuffer &buffer = GetThreadBuffer();
+
+  std::scoped_lock lock{m_buffersMutex};
+  buffer.name = std::move(name);
+  buffer.namePending = true;
+}
+
+TraceRecorder::ThreadBuffer &TraceRecorder::GetThreadBuffer() {
+  thread_local ThreadBuffer *threadBuffer = nullptr;
+
+  if (!threadBuffer) {
+    std::scoped_lock lock{m_buffersMutex};
+    m_buffers.push_back(std::make_unique<ThreadBuffer>());
+    threadBuffer = m_buffers.back().get();
+    threadBuffer->threadId = static_cast<int>(m_buffers.size());
+
+#ifdef __linux__
+    // Linux limits thread names to 15 characters plus the terminator
+    char name[16] = {};
+    if (pthread_getname_np(pthread_self(), name, sizeof(name)) == 0) {
+      threadBuffer->name = name;
+    }
+#endif
+    if (threadBuffer->name.empty()) {
+      threadBuffer->name = fmt::format("Thread {}", threadBuffer->threadId);
+    }
+  }
+  return *threadBuffer;
+}
+
+void TraceRecorder::Run() {
+  while (IsRecording()) {
+    Drain();
+    std::this_thread::sleep_for(kWritePeriod);
+  }
+
+  Drain();
+}
+
+void TraceRecorder::Drain() {
+  std::string batch;
+
+  {
+    // Buffers are never freed and this is the only consumer, so the events
+    // themselves can be read after the lock is released
+    std::scoped_lock lock{m_buffersMutex};
+    m_drainBuffers.clear();
+    for (auto &buffer : m_buffers) {
+      m_drainBuffers.emplace_back(
+          buffer.get(), buffer->head.load(std::memory_order_acquire));
+
+      if (buffer->namePending) {
+        fmt::format_to(std::back_inserter(batch),
+                       "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                       "\"tid\":{},\"args\":{{\"name\":\"",
+                       buffer->threadId);
+        AppendJsonEscaped(batch, buffer->name);
+        batch += "\"}},\n";
+        buffer->namePending = false;
+      }
+    }
+  }
+
+  for (auto [buffer, head] : m_drainBuffers) {
+    size_t tail = buffer->tail.load(std::memory_order_relaxed);
+
+    for (; tail != head; tail++) {
+      const Event &event = buffer->events[tail % kThreadBufferSize];
+      // Events from before this recording started are skipped
+      if (event.start < m_startTime) {
+        continue;
+      }
+
+      auto start = std::chrono::duration<double, std::micro>(event.start -
+                                                             m_startTime);
+      auto duration =
+          std::chrono::duration<double, std::micro>(event.end - event.start);
+      batch += "{\"name\":\"";
+      AppendJsonEscaped(batch, event.name);
+      fmt::format_to(std::back_inserter(batch),
+                     "\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,"
+                     "\"tid\":{}}},\n",
+                     start.count(), duration.count(), buffer->threadId);
+    }
+
+    buffer->tail.store(tail, std::memory_order_release);
+  }
+
+  m_file << batch;
+  m_file.flush();
+}
@@ -6,6 +6,9 @@
 
 using namespace subzero;
 
+// Must match the period of frc2::TrapezoidProfileSubsystem
+constexpr units::second_t kProfilePeriod = 20_ms;
+
 template <typename TController, typename TDistance>
 BaseSingleAxisSubsystem<TController, TDistance>::BaseSingleAxisSubsystem(
     std::string name, TController &controller,
@@ -14,6 +17,7 @@ BaseSingleAxisSubsystem<TController, TDistance>::BaseSingleAxisSubsystem(
     : frc2::TrapezoidProfileSubsystem<TDistance>{config.profileConstraints},
       m_minLimitSwitch{config.minLimitSwitch},
       m_maxLimitSwitch{config.maxLimitSwitch}, m_controller{controller},
+      m_sensorHandle{MotorSensorRegistry::getInstance().Register(&controller)},
       m_config{config}, m_name{name}, m_pidEnabled{false} {
   m_pidEnabled = false;
 
@@ -24,33 +28,88 @@ BaseSingleAxisSubsystem<TController, TDistance>::BaseSingleAxisSubsystem(
         config.mechanismConfig.color);
   }
 
+  if (config.useLimitSwitchInterrupts) {
+    // The switches are active-low, so being pressed is a falling edge
+    if (m_minLimitSwitch && m_minLimitSwitch.value()) {
+      m_minLimitInterrupt = std::make_unique<frc::AsynchronousInterrupt>(
+          *m_minLimitSwitch.value(), [this](bool, bool) {
+            OnLimitSwitchInterrupt(true,
+                                   m_minLimitInterrupt->GetFallingTimestamp());
+          });
+      m_minLimitInterrupt->SetInterruptEdges(false, true);
+      m_minLimitInterrupt->Enable();
+    }
+
+    if (m_maxLimitSwitch && m_maxLimitSwitch.value()) {
+      m_maxLimitInterrupt = std::make_unique<frc::AsynchronousInterrupt>(
+          *m_maxLimitSwitch.value(), [this](bool, bool) {
+            OnLimitSwitchInterrupt(false,
+                                   m_maxLimitInterrupt->GetFallingTimestamp());
+          });
+      m_maxLimitInterrupt->SetInterruptEdges(false, true);
+      m_maxLimitInterrupt->Enable();
+    }
+  }
+
   m_resetEncCmd = ResetRelativeEncoder();
   frc::SmartDashboard::PutData(m_name + " Reset Encoder", m_resetEncCmd.get());
   frc2::TrapezoidProfileSubsystem<TDistance>::Disable();
 }
 
+template <typename TController, typename TDistance>
+BaseSingleAxisSubsystem<TController, TDistance>::~BaseSingleAxisSubsystem() {
+  m_minLimitInterrupt.reset();
+  m_maxLimitInterrupt.reset();
+  MotorSensorRegistry::getInstance().Unregister(m_sensorHandle);
+  // Harness sweeps create many uniquely named instances
+  LoopProfiler::getInstance().ReleaseZone(m_periodicZone);
+}
+
 template <typename TController, typename TDistance>
 void BaseSingleAxisSubsystem<TController, TDistance>::Periodic() {
-  frc::SmartDashboard::PutBoolean(m_name + " Pid Enabled", m_pidEnabled);
-  frc::SmartDashboard::PutNumber(m_name + " Position",
-                                 GetCurrentPosition().value());
+  SUBZERO_PROFILE_SCOPE(m_periodicZone);
+
+  // Before the profile runs, so it doesn't drive into a switch for one more
+  // loop
+  HandleLimitSwitchEdges();
+
+  Distance_t currentPosition = GetCurrentPosition();
+  std::optional<double> absolutePosition = GetAbsolutePosition();
+
+  m_pidEnabledPublisher.Set(m_pidEnabled);
+  m_positionPublisher.Set(currentPosition.value());
   if (m_config.conversionFunction) {
-    std::string curPos =
-        m_config.conversionFunction.value()(GetCurrentPosition());
-    frc::SmartDashboard::PutString(m_name + " Converted Position", curPos);
+    // Only build the string when someone can see it
+    m_convertedPositionPublisher.SetLazy([this, currentPosition] {
+      return m_config.conversionFunction.value()(currentPosition);
+    });
   }
 
-  if (m_controller.GetAbsoluteEncoderPosition().has_value())
-    frc::SmartDashboard::PutNumber(
-        m_name + " Absolute Position",
-        m_controller.GetAbsoluteEncoderPosition().value());
-
-  if (m_controller.GetAbsoluteEncoderPosition().has_value()) {
-    Distance_t absEncValue =
-        Distance_t(std::abs(m_controller.GetAbsoluteEncoderPosition().value()));
+  if (absolutePosition.has_value())
+    m_absolutePositionPublisher.Set(absolutePosition.value());
+
+  if (absolutePosition.has_value() && m_config.absoluteEncoderSeeding &&
+      m_config.absoluteEncoderDistancePerRevolution) {
+    Distance_t seeded = GetSeededPosition(absolutePosition.value());
+    Distance_t drift = units::math::abs(seeded - currentPosition);
+
+    if (!m_absoluteSeeded ||
+        drift > m_config.absoluteEncoderSeeding.value().driftThreshold) {
+      if (m_absoluteSeeded) {
+        ConsoleWriter.logWarning(m_name,
+                                 "Relative encoder drifted by %f; re-seeding",
+                                 drift.value());
+      }
+
+      m_controller.SetEncoderPosition(seeded.value());
+      MotorSensorRegistry::getInstance().Refresh(m_sensorHandle);
+      m_absoluteSeeded = true;
+    }
+  } else if (absolutePosition.has_value()) {
+    Distance_t absEncValue = Distance_t(std::abs(absolutePosition.value()));
 
     if (!resetOccurred && absEncValue <= m_config.tolerance) {
-      m_controller.ResetEncoder();
+      ResetEncoder();
       resetOccurred = true;
     } else if (resetOccurred && absEncValue > m_config.tolerance) {
       resetOccurred = false;
@@ -63,21 +122,58 @@ void BaseSingleAxisSubsystem<TController, TDistance>::Periodic() {
 
   m_controller.Update();
 
-  if (!m_pidEnabled && !IsMovementAllowed(m_latestSpeed)) {
-    ConsoleWriter.logInfo(m_name,
-                          "Periodic: Movement with speed %f is not allowed",
-                          m_latestSpeed);
+  // Homing drives past the soft limits on purpose
+  if (!m_pidEnabled && !m_homing && !IsMovementAllowed(m_latestSpeed)) {
+    FanoutWriter.logInfo(m_name,
+                         "Periodic: Movement with speed %f is not allowed",
+                         m_latestSpeed);
 
     Stop();
   }
 }
 
+template <typename TController, typename TDistance>
+void BaseSingleAxisSubsystem<TController, TDistance>::UseState(
+    PidState setpoint) {
+  m_profileState = setpoint;
+
+  // Blend into the next segment as soon as the profile arrives at the
+  // current waypoint, keeping its velocity
+  if (m_waypointIndex + 1 < m_waypoints.size() &&
+      units::math::abs(setpoint.position -
+                       m_waypoints[m_waypointIndex].position) <=
+          m_config.tolerance) {
+    m_waypointIndex++;
+    frc2::TrapezoidProfileSubsystem<TDistance>::SetGoal(
+        m_waypoints[m_waypointIndex]);
+  }
+
+  if (!m_config.feedforward) {
+    m_controller.TrackPosition(setpoint.position.value(), 0_V);
+    return;
+  }
+
+  // The profile only exposes velocity, so acceleration comes from consecutive
+  // setpoints
+  Acceleration_t acceleration =
+      m_lastSetpointVelocity
+          ? (setpoint.velocity - m_lastSetpointVelocity.value()) /
+                kProfilePeriod
+          : Acceleration_t(0);
+  m_lastSetpointVelocity = setpoint.velocity;
+
+  m_controller.TrackPosition(setpoint.position.value(),
+                             m_config.feedforward.value().Calculate(
+                                 setpoint.position.value(),
+                                 setpoint.velocity.value(),
+                                 acceleration.value()));
+}
+
 template <typename TController, typename TDistance>
 void BaseSingleAxisSubsystem<TController, TDistance>::RunMotorPercentage(
     double percentSpeed, bool ignoreEncoder) {
   bool movementAllowed = IsMovementAllowed(percentSpeed, ignoreEncoder);
-  frc::SmartDashboard::PutBoolean(m_name + " Movement Allowed",
-                                  movementAllowed);
+  m_movementAllowedPublisher.Set(movementAllowed);
 
   if (!movementAllowed) {
     Stop();
@@ -86,27 +182,40 @@ void BaseSingleAxisSubsystem<TController, TDistance>::RunMotorPercentage(
 
   DisablePid();
 
-  frc::SmartDashboard::PutNumber(m_name + " Speed %", percentSpeed);
+  m_speedPublisher.Set(percentSpeed);
 
   m_controller.Set(percentSpeed);
 }
 
 template <typename TController, typename TDistance>
 void BaseSingleAxisSubsystem<TController, TDistance>::Stop() {
-  frc::SmartDashboard::PutNumber(m_name + " Speed %", 0);
+  m_speedPublisher.Set(0);
   m_controller.Stop();
 }
 
 template <typename TController, typename TDistance>
 void BaseSingleAxisSubsystem<TController, TDistance>::ResetEncoder() {
   m_controller.ResetEncoder();
+  MotorSensorRegistry::getInstance().Refresh(m_sensorHandle);
 }
 
 template <typename TController, typename TDistance>
 bool BaseSingleAxisSubsystem<TController, TDistance>::AtLimitSwitchMin() {
   if (m_minLimitSwitch && m_minLimitSwitch.value()) {
     bool value = !m_minLimitSwitch.value()->Get();
-    frc::SmartDashboard::PutBoolean(m_name + " Min Limit Switch", value);
+
+    if (m_minLimitLatched && !value) {
+      auto sample =
+          MotorSensorRegistry::getInstance().GetSample(m_sensorHandle);
+      double velocity = sample ? sample.value().velocity
+                               : m_controller.GetEncoderVelocity();
+      if (velocity > 0) {
+        m_minLimitLatched = false;
+      }
+    }
+
+    value = value || m_minLimitLatched;
+    m_minLimitSwitchPublisher.Set(value);
     return value;
   }
 
@@ -117,13 +226,84 @@ template <typename TController, typename TDistance>
 bool BaseSingleAxisSubsystem<TController, TDistance>::AtLimitSwitchMax() {
   if (m_maxLimitSwitch && m_maxLimitSwitch.value()) {
     bool value = !m_maxLimitSwitch.value()->Get();
-    frc::SmartDashboard::PutBoolean(m_name + " Max Limit Switch", value);
+
+    if (m_maxLimitLatched && !value) {
+      auto sample =
+          MotorSensorRegistry::getInstance().GetSample(m_sensorHandle);
+      double velocity = sample ? sample.value().velocity
+                               : m_controller.GetEncoderVelocity();
+      if (velocity < 0) {
+        m_maxLimitLatched = false;
+      }
+    }
+
+    value = value || m_maxLimitLatched;
+    m_maxLimitSwitchPublisher.Set(value);
     return value;
   }
 
   return false;
 }
 
+template <typename TController, typename TDistance>
+std::optional<units::second_t>
+BaseSingleAxisSubsystem<TController, TDistance>::GetMinLimitLatchTime() {
+  if (!m_minLimitLatched) {
+    return std::nullopt;
+  }
+
+  return units::second_t(m_minLimitLatchTime.load());
+}
+
+template <typename TController, typename TDistance>
+void BaseSingleAxisSubsystem<TController, TDistance>::OnLimitSwitchInterrupt(
+    bool isMin, units::second_t edgeTime) {
+  // The controller and profile belong to the main thread, so only record the
+  // edge here
+  if (isMin) {
+    m_minLimitLatchTime = edgeTime.value();
+    m_minLimitLatched = true;
+    m_minLimitEdgePending = true;
+  } else {
+    m_maxLimitLatched = true;
+    m_maxLimitEdgePending = true;
+  }
+}
+
+template <typename TController, typename TDistance>
+void BaseSingleAxisSubsystem<TController, TDistance>::
+    HandleLimitSwitchEdges() {
+  bool minEdge = m_minLimitEdgePending.exchange(false);
+  bool maxEdge = m_maxLimitEdgePending.exchange(false);
+  if (!minEdge && !maxEdge) {
+    return;
+  }
+
+  auto sample = MotorSensorRegistry::getInstance().GetSample(m_sensorHandle);
+  double velocity =
+      sample ? sample.value().velocity : m_controller.GetEncoderVelocity();
+
+  if ((minEdge && velocity <= 0) || (maxEdge && velocity >= 0)) {
+    // Stopping alone would be undone by the profile on its next step
+    if (m_pidEnabled) {
+      DisablePid();
+    } else {
+      Stop();
+    }
+  }
+
+  // Only homing zeroes at the edge; otherwise brushing the switch would move
+  // the axis' zero
+  if (minEdge && m_homing) {
+    // The encoder reads 0 at the edge, plus whatever was travelled since
+    units::second_t latency = frc::Timer::GetFPGATimestamp() -
+                              units::second_t(m_minLimitLatchTime.load());
+    m_controller.SetEncoderPosition(velocity * latency.value());
+    MotorSensorRegistry::getInstance().Refresh(m_sensorHandle);
+    m_zeroedAtEdge = true;
+  }
+}
+
 template <typename TController, typename TDistance>
 frc2::CommandPtr
 BaseSingleAxisSubsystem<TController, TDistance>::MoveToPositionAbsolute(
@@ -143,6 +323,7 @@ BaseSingleAxisSubsystem<TController, TDistance>::MoveToPositionAbsolute(
                    m_name, "Moving to absolute position %f", position.value());
 
                m_goalPosition = position;
+               m_waypoints.clear();
                EnablePid();
                frc2::TrapezoidProfileSubsystem<TDistance>::SetGoal(position);
              },
@@ -150,26 +331,247 @@ BaseSingleAxisSubsystem<TController, TDistance>::MoveToPositionAbsolute(
       .ToPtr();
 }
 
+template <typename TController, typename TDistance>
+frc2::CommandPtr
+BaseSingleAxisSubsystem<TController, TDistance>::MoveThroughWaypoints(
+    std::vector<Waypoint> waypoints) {
+  if (!ValidateWaypoints(waypoints)) {
+    return EmptyCommand().ToPtr();
+  }
+
+  return frc2::InstantCommand(
+             [this, waypoints] {
+               // Where the first segment starts is only known now
+               if (!ValidateWaypoints(waypoints, GetCurrentPosition())) {
+                 return;
+               }
+
+               ConsoleWriter.logVerbose(
+                   m_name, "Moving through %d waypoints to %f",
+                   static_cast<int>(waypoints.size()),
+                   waypoints.back().position.value());
+
+               m_waypoints = waypoints;
+               m_waypointIndex = 0;
+               m_goalPosition = waypoints.back().position;
+               EnablePid();
+               frc2::TrapezoidProfileSubsystem<TDistance>::SetGoal(
+                   m_waypoints.front());
+             },
+             {this})
+      .ToPtr();
+}
+
+template <typename TController, typename TDistance>
+bool BaseSingleAxisSubsystem<TController, TDistance>::ValidateWaypoints(
+    const std::vector<Waypoint> &waypoints, std::optional<Distance_t> start) {
+  if (waypoints.empty()) {
+    ConsoleWriter.logWarning(m_name, "No waypoints given%s", "");
+    return false;
+  }
+
+  if (waypoints.back().velocity != Velocity_t(0)) {
+    ConsoleWriter.logWarning(m_name, "The last waypoint must end at rest%s",
+                             "");
+    return false;
+  }
+
+  auto maxVelocity = m_config.profileConstraints.maxVelocity;
+  auto maxAcceleration = m_config.profileConstraints.maxAcceleration;
+
+  for (size_t i = 0; i < waypoints.size(); i++) {
+    const Waypoint &waypoint = waypoints[i];
+
+    if (waypoint.position < m_config.minDistance ||
+        waypoint.position > m_config.maxDistance) {
+      ConsoleWriter.logWarning(m_name,
+                               "Waypoint %d at %f is outside of boundary",
+                               static_cast<int>(i), waypoint.position.value());
+      return false;
+    }
+
+    if (units::math::abs(waypoint.velocity) > maxVelocity) {
+      ConsoleWriter.logWarning(m_name,
+                               "Waypoint %d velocity %f exceeds the max of %f",
+                               static_cast<int>(i), waypoint.velocity.value(),
+                               maxVelocity.value());
+      return false;
+    }
+
+    if (waypoint.velocity == Velocity_t(0)) {
+      continue;
+    }
+
+    // Passing through with speed only makes sense when the next segment
+    // continues in the same direction
+    const Waypoint &next = waypoints[i + 1];
+    bool movingUp = waypoint.velocity > Velocity_t(0);
+    // The first segment starts wherever the axis is; starting on the
+    // waypoint has no direction to check
+    std::optional<Distance_t> previous =
+        i > 0 ? std::optional{waypoints[i - 1].position} : start;
+    bool reverses =
+        previous &&
+        units::math::abs(waypoint.position - previous.value()) >
+            m_config.tolerance &&
+        (waypoint.position > previous.value()) != movingUp;
+    if ((next.position > waypoint.position) != movingUp || reverses) {
+      ConsoleWriter.logWarning(
+          m_name, "Waypoint %d velocity reverses the direction of travel",
+          static_cast<int>(i));
+      return false;
+    }
+
+    // If the sequence is cancelled here, the axis has to be able to stop
+    // before a limit
+    Distance_t brakingDistance =
+        waypoint.velocity * waypoint.velocity / (2 * maxAcceleration);
+    Distance_t room = movingUp ? m_config.maxDistance - waypoint.position
+                               : waypoint.position - m_config.minDistance;
+    if (brakingDistance > room) {
+      ConsoleWriter.logWarning(
+          m_name, "Waypoint %d is too fast to stop %f before the limit",
+          static_cast<int>(i), brakingDistance.value());
+      return false;
+    }
+
+    // The next waypoint's velocity has to be reachable within the segment
+    Distance_t changeDistance =
+        units::math::abs(waypoint.velocity * waypoint.velocity -
+                         next.velocity * next.velocity) /
+        (2 * maxAcceleration);
+    if (changeDistance > units::math::abs(next.position - waypoint.position)) {
+      ConsoleWriter.logWarning(
+          m_name, "Segment after waypoint %d is too short to reach %f",
+          static_cast<int>(i), next.velocity.value());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename TController, typename TDistance>
+typename BaseSingleAxisSubsystem<TController, TDistance>::Distance_t
+BaseSingleAxisSubsystem<TController, TDistance>::GetSeededPosition(
+    double absolutePosition) {
+  double range = m_config.absoluteEncoderDistancePerRevolution.value().value();
+  double position =
+      absolutePosition - m_config.absoluteEncoderSeeding.value().offset.value();
+  double travel = (m_config.maxDistance - m_config.minDistance).value();
+
+  if (range >= travel) {
+    // One revolution covers the whole range of motion, so there's exactly one
+    // match inside a window centered on it
+    double windowStart = m_config.minDistance.value() - (range - travel) / 2;
+    double wrapped = std::fmod(position - windowStart, range);
+    return Distance_t(windowStart + (wrapped < 0 ? wrapped + range : wrapped));
+  }
+
+  // Otherwise the reading is ambiguous; trust the relative encoder to pick the
+  // nearest revolution
+  double current = GetCurrentPosition().value();
+  return Distance_t(current + std::remainder(position - current, range));
+}
+
 template <typename TController, typename TDistance>
 frc2::CommandPtr BaseSingleAxisSubsystem<TController, TDistance>::Home() {
+  bool hasMinSwitch = m_minLimitSwitch && m_minLimitSwitch.value();
+  if (!hasMinSwitch && m_config.stallHoming) {
+    return StallHome();
+  }
+
   return frc2::FunctionalCommand(
              // OnInit
-             [this] { Stop(); },
+             [this] {
+               Stop();
+
+               // A stale latch would end homing before it starts
+               if (m_minLimitSwitch && m_minLimitSwitch.value() &&
+                   m_minLimitSwitch.value()->Get()) {
+                 m_minLimitLatched = false;
+                 m_minLimitEdgePending = false;
+               }
+               m_homing = true;
+               m_zeroedAtEdge = false;
+             },
              // OnExecute
              [this] { RunMotorSpeedDefault(true); },
              // OnEnd
              [this](bool interrupted) {
+               // An edge since the last Periodic still zeroes at the edge
+               HandleLimitSwitchEdges();
+               m_homing = false;
                Stop();
-               ResetEncoder();
+
+               // Zeroing at the interrupt's edge time is more accurate than
+               // zeroing now
+               if (!m_zeroedAtEdge) {
+                 ResetEncoder();
+               }
              },
              // IsFinished
              [this] { return AtLimitSwitchMin(); }, {this})
       .ToPtr();
 }
 
+template <typename TController, typename TDistance>
+frc2::CommandPtr BaseSingleAxisSubsystem<TController, TDistance>::StallHome() {
+  return frc2::FunctionalCommand(
+             // OnInit
+             [this] {
+               DisablePid();
+               m_stalled = false;
+               m_stallDebouncer =
+                   frc::Debouncer(m_config.stallHoming.value().debounceTime);
+               m_homingTimer.Restart();
+               m_homing = true;
+             },
+             // OnExecute
+             [this] {
+               // Bypasses the soft limits, since the encoder can't be trusted
+               // until homing is done
+               m_controller.Set(m_config.stallHoming.value().voltage);
+             },
+             // OnEnd
+             [this](bool interrupted) {
+               m_homing = false;
+               Stop();
+
+               if (m_stalled) {
+                 ResetEncoder();
+               } else {
+                 ConsoleWriter.logWarning(
+                     m_name, "Stall homing %s before finding the hard stop",
+                     interrupted ? "was interrupted" : "timed out");
+               }
+             },
+             // IsFinished
+             [this] {
+               const StallHomingConfig &config = m_config.stallHoming.value();
+               auto sample =
+                   MotorSensorRegistry::getInstance().GetSample(m_sensorHandle);
+               units::ampere_t current = sample
+                                             ? sample.value().current
+                                             : m_controller.GetOutputCurrent();
+               double velocity = sample ? sample.value().velocity
+                                        : m_controller.GetEncoderVelocity();
+
+               m_stalled = m_stallDebouncer.Calculate(
+                   m_homingTimer.HasElapsed(config.blankingTime) &&
+                   current >= config.currentThreshold &&
+                   std::abs(velocity) <= config.velocityThreshold);
+
+               return m_stalled || m_homingTimer.HasElapsed(config.timeout);
+             },
+             {this})
+      .ToPtr();
+}
+
 template <typename TController, typename TDistance>
 void BaseSingleAxisSubsystem<TController, TDistance>::DisablePid() {
   m_pidEnabled = false;
+  m_waypoints.clear();
   Stop();
   frc2::TrapezoidProfileSubsystem<TDistance>::Disable();
 }
@@ -177,6 +579,7 @@ void BaseSingleAxisSubsystem<TController, TDistance>::DisablePid() {
 template <typename TController, typename TDistance>
 void BaseSingleAxisSubsystem<TController, TDistance>::EnablePid() {
   m_pidEnabled = true;
+  m_lastSetpointVelocity = std::nullopt;
   frc2::TrapezoidProfileSubsystem<TDistance>::Enable();
 }
 
@@ -189,6 +592,17 @@ void BaseSingleAxisSubsystem<TController, TDistance>::OnInit() {
   if (m_config.absoluteEncoderDistancePerRevolution.has_value())
     m_controller.SetAbsoluteEncoderConversionFactor(
         m_config.absoluteEncoderDistancePerRevolution.value().value());
+
+  if (m_config.absoluteEncoderSeeding &&
+      m_config.absoluteEncoderDistancePerRevolution &&
+      m_config.absoluteEncoderDistancePerRevolution.value() <
+          m_config.maxDistance - m_config.minDistance) {
+    ConsoleWriter.logWarning(
+        m_name,
+        "Absolute encoder wraps within the range of motion; seeding assumes "
+        "the axis starts within half a revolution of 0%s",
+        "");
+  }
 }
 
 template <typename TController, typename TDistance>
@@ -200,8 +614,8 @@ bool BaseSingleAxisSubsystem<TController, TDistance>::IsMovementAllowed(
   bool atMin = ignoreEncoder ? AtLimitSwitchMin() : AtHome();
   bool atMax = ignoreEncoder ? AtLimitSwitchMax() : AtMax();
 
-  frc::SmartDashboard::PutBoolean(m_name + " At Min", atMin);
-  frc::SmartDashboard::PutBoolean(m_name + " At Max", atMax);
+  m_atMinPublisher.Set(atMin);
+  m_atMaxPublisher.Set(atMax);
 
   if (atMin) {
     return speed >= 0;
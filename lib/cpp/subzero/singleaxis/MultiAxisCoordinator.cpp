@@ -0,0 +1,296 @@
+#include "subzero/singleaxis/MultiAxisCoordinator.h"
+
+#include <frc2/command/Commands.h>
+#include <frc2/command/DeferredCommand.h>
+#include <units/math.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+
+MultiAxisCoordinator::MultiAxisCoordinator(
+    std::vector<CoordinatedAxis> axes,
+    std::vector<ForbiddenRegion> forbiddenRegions,
+    units::second_t checkResolution)
+    : m_axes{axes}, m_forbiddenRegions{forbiddenRegions},
+      m_checkResolution{checkResolution} {
+  // The collision checks would never advance
+  if (m_checkResolution <= 0_s) {
+    ConsoleWriter.logError("MultiAxisCoordinator",
+                           "Check resolution %f s must be positive; using %f s",
+                           checkResolution.value(),
+                           kDefaultCheckResolution.value());
+    m_checkResolution = kDefaultCheckResolution;
+  }
+
+  for (auto &region : m_forbiddenRegions) {
+    if (region.bounds.size() != m_axes.size()) {
+      ConsoleWriter.logWarning(
+          "MultiAxisCoordinator",
+          "Region %s has %d bounds for %d axes; missing ones are unbounded",
+          region.name.c_str(), static_cast<int>(region.bounds.size()),
+          static_cast<int>(m_axes.size()));
+      region.bounds.resize(m_axes.size(), ForbiddenRegion::kAnyPosition);
+    }
+  }
+}
+
+MultiAxisCoordinator::MotionPlan
+MultiAxisCoordinator::Plan(const std::vector<double> &start,
+                           const std::vector<double> &goal) const {
+  std::vector<AxisState> states;
+  states.reserve(start.size());
+  for (double position : start) {
+    states.push_back({.position = position, .velocity = 0});
+  }
+  return Plan(states, goal);
+}
+
+MultiAxisCoordinator::MotionPlan
+MultiAxisCoordinator::Plan(const std::vector<AxisState> &start,
+                           const std::vector<double> &goal) const {
+  MotionPlan best{.valid = false, .totalTime = 0_s, .axes = {}};
+
+  if (start.size() != m_axes.size() || goal.size() != m_axes.size()) {
+    ConsoleWriter.logError("MultiAxisCoordinator",
+                           "Expected %d positions per state",
+                           static_cast<int>(m_axes.size()));
+    return best;
+  }
+
+  if (IsForbidden(goal)) {
+    ConsoleWriter.logWarning("MultiAxisCoordinator",
+                             "Goal is inside a forbidden region%s", "");
+    return best;
+  }
+
+  std::vector<AxisPlan> axes(m_axes.size());
+  for (size_t i = 0; i < m_axes.size(); i++) {
+    axes[i] = AxisPlan{.start = start[i].position,
+                       .startVelocity = start[i].velocity,
+                       .goal = goal[i],
+                       .startDelay = 0_s,
+                       .duration = 0_s};
+    axes[i].duration = ProfileDuration(m_axes[i], axes[i]);
+  }
+
+  auto totalTime = [](const std::vector<AxisPlan> &plan) {
+    units::second_t total = 0_s;
+    for (auto &axis : plan) {
+      total = units::math::max(total, axis.startDelay + axis.duration);
+    }
+    return total;
+  };
+
+  // Moving everything at once is the fastest possible plan
+  if (IsCollisionFree(axes, std::vector<bool>(axes.size(), true))) {
+    return MotionPlan{
+        .valid = true, .totalTime = totalTime(axes), .axes = axes};
+  }
+
+  // Otherwise try each order of axes, starting each one as early as possible
+  // without colliding with the ones already moving
+  std::vector<size_t> order(m_axes.size());
+  std::iota(order.begin(), order.end(), 0);
+
+  // Axes already in motion keep going, so only the ones at rest can wait
+  std::vector<bool> alreadyMoving(m_axes.size());
+  for (size_t i = 0; i < m_axes.size(); i++) {
+    alreadyMoving[i] = axes[i].startVelocity != 0;
+  }
+
+  do {
+    std::vector<AxisPlan> candidate = axes;
+    std::vector<bool> moving = alreadyMoving;
+    bool feasible = true;
+
+    for (size_t index : order) {
+      if (alreadyMoving[index]) {
+        continue;
+      }
+
+      // Starting once everything else is done is the last resort
+      units::second_t latestStart = 0_s;
+      for (size_t i = 0; i < m_axes.size(); i++) {
+        if (moving[i]) {
+          latestStart = units::math::max(
+              latestStart, candidate[i].startDelay + candidate[i].duration);
+        }
+      }
+
+      moving[index] = true;
+      feasible = false;
+      for (units::second_t delay = 0_s;; delay += m_checkResolution) {
+        candidate[index].startDelay = units::math::min(delay, latestStart);
+        if (IsCollisionFree(candidate, moving)) {
+          feasible = true;
+          break;
+        }
+
+        if (delay >= latestStart) {
+          break;
+        }
+      }
+
+      if (!feasible) {
+        break;
+      }
+    }
+
+    // Covers the case where every axis was already moving, so nothing above
+    // checked them
+    feasible = feasible &&
+               IsCollisionFree(candidate, std::vector<bool>(axes.size(), true));
+
+    if (feasible && (!best.valid || totalTime(candidate) < best.totalTime)) {
+      best = MotionPlan{
+          .valid = true, .totalTime = totalTime(candidate), .axes = candidate};
+    }
+  } while (std::next_permutation(order.begin(), order.end()));
+
+  if (!best.valid) {
+    ConsoleWriter.logWarning("MultiAxisCoordinator",
+                             "No collision-free plan found%s", "");
+  }
+
+  return best;
+}
+
+frc2::CommandPtr MultiAxisCoordinator::MoveTo(std::vector<double> goal) {
+  std::vector<frc2::Subsystem *> subsystems;
+  for (auto &axis : m_axes) {
+    if (axis.requirement) {
+      subsystems.push_back(axis.requirement);
+    }
+  }
+
+  return frc2::DeferredCommand(
+             [this, goal] {
+               // The subsystems continue from their last setpoints, not
+               // from rest at the measured positions
+               std::vector<AxisState> start(m_axes.size());
+               for (size_t i = 0; i < m_axes.size(); i++) {
+                 start[i] = m_axes[i].getState();
+               }
+
+               MotionPlan plan = Plan(start, goal);
+               if (!plan.valid) {
+                 return frc2::cmd::None();
+               }
+
+               std::vector<frc2::CommandPtr> moves;
+               moves.reserve(m_axes.size() + 1);
+               for (size_t i = 0; i < m_axes.size(); i++) {
+                 moves.push_back(
+                     frc2::cmd::Wait(plan.axes[i].startDelay)
+                         .AndThen(m_axes[i].moveTo(plan.axes[i].goal)));
+               }
+               // The moves themselves end immediately, so hold the
+               // requirements until the profiles are done
+               moves.push_back(frc2::cmd::Wait(plan.totalTime));
+
+               return frc2::cmd::Parallel(std::move(moves));
+             },
+             subsystems)
+      .ToPtr();
+}
+
+void MultiAxisCoordinator::Report(const MotionPlan &plan) const {
+  if (!plan.valid) {
+    ConsoleWriter.logInfo("MultiAxisCoordinator", "No valid plan%s", "");
+    return;
+  }
+
+  ConsoleWriter.logInfo("MultiAxisCoordinator", "Total time %.3f s",
+                        plan.totalTime.value());
+  for (size_t i = 0; i < plan.axes.size(); i++) {
+    ConsoleWriter.logInfo(
+        "MultiAxisCoordinator",
+        "%s: %.3f -> %.3f, starts at %.3f s, takes %.3f s",
+        m_axes[i].name.c_str(), plan.axes[i].start, plan.axes[i].goal,
+        plan.axes[i].startDelay.value(), plan.axes[i].duration.value());
+  }
+}
+
+MultiAxisCoordinator::Profile
+MultiAxisCoordinator::MakeProfile(const CoordinatedAxis &axis) {
+  return Profile{{units::meters_per_second_t(axis.maxVelocity),
+                  units::meters_per_second_squared_t(axis.maxAcceleration)}};
+}
+
+double MultiAxisCoordinator::PositionAt(const CoordinatedAxis &axis,
+                                        const AxisPlan &plan,
+                                        units::second_t time) {
+  units::second_t t = time - plan.startDelay;
+
+  if (t <= 0_s) {
+    return plan.start;
+  }
+  if (t >= plan.duration) {
+    return plan.goal;
+  }
+
+  return MakeProfile(axis)
+      .Calculate(t,
+                 {units::meter_t(plan.start),
+                  units::meters_per_second_t(plan.startVelocity)},
+                 {units::meter_t(plan.goal), 0_mps})
+      .position.value();
+}
+
+units::second_t
+MultiAxisCoordinator::ProfileDuration(const CoordinatedAxis &axis,
+                                      const AxisPlan &plan) {
+  Profile profile = MakeProfile(axis);
+  profile.Calculate(0_s,
+                    {units::meter_t(plan.start),
+                     units::meters_per_second_t(plan.startVelocity)},
+                    {units::meter_t(plan.goal), 0_mps});
+  return profile.TotalTime();
+}
+
+bool MultiAxisCoordinator::IsForbidden(
+    const std::vector<double> &positions) const {
+  return std::any_of(
+      m_forbiddenRegions.begin(), m_forbiddenRegions.end(),
+      [&positions](const ForbiddenRegion &region) {
+        for (size_t i = 0; i < positions.size(); i++) {
+          if (positions[i] < region.bounds[i].first ||
+              positions[i] > region.bounds[i].second) {
+            return false;
+          }
+        }
+        return true;
+      });
+}
+
+bool MultiAxisCoordinator::IsCollisionFree(
+    const std::vector<AxisPlan> &axes, const std::vector<bool> &moving) const {
+  units::second_t end = 0_s;
+  for (size_t i = 0; i < axes.size(); i++) {
+    if (moving[i]) {
+      end = units::math::max(end, axes[i].startDelay + axes[i].duration);
+    }
+  }
+
+  std::vector<double> positions(axes.size());
+  for (units::second_t time = 0_s;; time += m_checkResolution) {
+    time = units::math::min(time, end);
+
+    for (size_t i = 0; i < axes.size(); i++) {
+      positions[i] =
+          moving[i] ? PositionAt(m_axes[i], axes[i], time) : axes[i].start;
+    }
+
+    if (IsForbidden(positions)) {
+      return false;
+    }
+
+    if (time >= end) {
+      return true;
+    }
+  }
+}
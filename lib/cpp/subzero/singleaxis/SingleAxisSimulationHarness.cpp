@@ -0,0 +1,186 @@
+#pragma once
+
+#include "subzero/singleaxis/SingleAxisSimulationHarness.h"
+
+#include <units/math.h>
+
+#include <algorithm>
+#include <atomic>
+
+#include "subzero/singleaxis/LinearSingleAxisSubsystem.cpp"
+#include "subzero/singleaxis/RotationalSingleAxisSubsystem.cpp"
+
+using namespace subzero;
+
+// Must match the period of frc2::TrapezoidProfileSubsystem
+constexpr units::second_t kSimulationLoopTime = 20_ms;
+
+template <typename TDistance>
+typename SingleAxisSimulationHarness<TDistance>::SimulationResult
+SingleAxisSimulationHarness<TDistance>::Run(const SimulationCase &simCase) {
+  units::second_t simTime = 0_s;
+  PhysicsSimPidMotorController controller{simCase.name, simCase.pidSettings,
+                                          simCase.physicsConfig,
+                                          [&simTime] { return simTime; }};
+
+  std::unique_ptr<Subsystem> subsystem;
+  std::optional<frc2::CommandPtr> moveCommand;
+  {
+    std::lock_guard<std::mutex> lock(SingleAxisSimulation::registrationMutex);
+    subsystem = m_factory(simCase.name, controller, simCase.config);
+    // Run the real command so boundary checks apply just like on the robot
+    moveCommand = subsystem->MoveToPositionAbsolute(simCase.goal);
+  }
+
+  subsystem->OnInit();
+  controller.SetMechanismPosition(0);
+  moveCommand.value().get()->Initialize();
+
+  double direction = simCase.goal > Distance_t(0) ? 1.0 : -1.0;
+  SimulationResult result{.name = simCase.name,
+                          .timeToGoal = std::nullopt,
+                          .overshoot = Distance_t(0),
+                          .finalError = simCase.goal,
+                          .limitViolations = 0};
+  std::optional<units::second_t> enteredTolerance;
+
+  while (simTime < simCase.timeout) {
+    simTime += kSimulationLoopTime;
+    // Safe to run alongside other cases: besides this case's own subsystem
+    // and controller, Periodic only reaches the Console and Fanout loggers,
+    // the MotorSensorRegistry, the LoopProfiler and NT publishers, which all
+    // lock internally. Nothing here calls MotorSensorRegistry::Refresh(),
+    // which would read other cases' controllers
+    subsystem->Periodic();
+
+    Distance_t position = Distance_t(controller.GetMechanismPosition());
+    result.finalError = simCase.goal - position;
+    result.overshoot = units::math::max(
+        result.overshoot, (position - simCase.goal) * direction);
+
+    if (position < simCase.config.minDistance ||
+        position > simCase.config.maxDistance) {
+      result.limitViolations++;
+    }
+
+    if (units::math::abs(result.finalError) <= simCase.config.tolerance) {
+      if (!enteredTolerance) {
+        enteredTolerance = simTime;
+      }
+
+      if (simTime - enteredTolerance.value() >= simCase.settleTime) {
+        break;
+      }
+    } else {
+      enteredTolerance = std::nullopt;
+    }
+  }
+
+  if (enteredTolerance &&
+      simTime - enteredTolerance.value() >= simCase.settleTime) {
+    result.timeToGoal = enteredTolerance;
+  }
+
+  {
+    // Destroying a command also unregisters it from the scheduler
+    std::lock_guard<std::mutex> lock(SingleAxisSimulation::registrationMutex);
+    moveCommand.reset();
+    subsystem.reset();
+  }
+
+  return result;
+}
+
+template <typename TDistance>
+std::vector<typename SingleAxisSimulationHarness<TDistance>::SimulationResult>
+SingleAxisSimulationHarness<TDistance>::RunAll(
+    const std::vector<SimulationCase> &cases, unsigned int threadCount) {
+  std::vector<SimulationResult> results(cases.size());
+  std::atomic<size_t> nextCase = 0;
+
+  std::vector<std::thread> workers;
+  workers.reserve(std::max(threadCount, 1u));
+  for (unsigned int i = 0; i < std::max(threadCount, 1u); i++) {
+    workers.emplace_back([&] {
+      for (size_t index = nextCase++; index < cases.size();
+           index = nextCase++) {
+        results[index] = Run(cases[index]);
+      }
+    });
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  return results;
+}
+
+template <typename TDistance>
+std::vector<typename SingleAxisSimulationHarness<TDistance>::SimulationCase>
+SingleAxisSimulationHarness<TDistance>::ExpandGrid(
+    const SimulationCase &base,
+    const std::vector<std::vector<std::function<void(SimulationCase &)>>>
+        &dimensions) {
+  std::vector<SimulationCase> cases{base};
+
+  for (auto &dimension : dimensions) {
+    std::vector<SimulationCase> expanded;
+    expanded.reserve(cases.size() * dimension.size());
+
+    for (auto &simCase : cases) {
+      for (size_t i = 0; i < dimension.size(); i++) {
+        SimulationCase variation = simCase;
+        dimension[i](variation);
+        variation.name += "/" + std::to_string(i);
+        expanded.push_back(variation);
+      }
+    }
+
+    cases = std::move(expanded);
+  }
+
+  return cases;
+}
+
+template <typename TDistance>
+void SingleAxisSimulationHarness<TDistance>::Report(
+    const std::vector<SimulationResult> &results) {
+  for (auto &result : results) {
+    ConsoleWriter.logInfo(
+        "SingleAxisSimulationHarness",
+        "%s: time to goal=%s, overshoot=%.4f, final error=%.4f, limit "
+        "violations=%d",
+        result.name.c_str(),
+        result.timeToGoal
+            ? (std::to_string(result.timeToGoal.value().value()) + " s").c_str()
+            : "never",
+        result.overshoot.value(), result.finalError.value(),
+        result.limitViolations);
+  }
+}
+
+template <typename TDistance>
+typename SingleAxisSimulationHarness<TDistance>::SubsystemFactory
+SingleAxisSimulationHarness<TDistance>::LinearFactory() {
+  return [](std::string name, PhysicsSimPidMotorController &controller,
+            SingleAxisConfig config) -> std::unique_ptr<Subsystem> {
+    return std::make_unique<
+        LinearSingleAxisSubsystem<PhysicsSimPidMotorController>>(
+        name, controller, config);
+  };
+}
+
+template <typename TDistance>
+typename SingleAxisSimulationHarness<TDistance>::SubsystemFactory
+SingleAxisSimulationHarness<TDistance>::RotationalFactory(
+    units::meter_t armatureLength) {
+  return [armatureLength](std::string name,
+                          PhysicsSimPidMotorController &controller,
+                          SingleAxisConfig config)
+             -> std::unique_ptr<Subsystem> {
+    return std::make_unique<
+        RotationalSingleAxisSubsystem<PhysicsSimPidMotorController>>(
+        name, controller, config, armatureLength);
+  };
+}
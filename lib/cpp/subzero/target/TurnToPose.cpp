@@ -4,6 +4,8 @@
 #include <frc/smartdashboard/SmartDashboard.h>
 #include <frc/trajectory/TrajectoryGenerator.h>
 
+#include "subzero/profiling/LoopProfiler.h"
+
 using namespace subzero;
 
 TurnToPose::TurnToPose(TurnToPoseConfig config,
@@ -24,6 +26,8 @@ TurnToPose::TurnToPose(TurnToPoseConfig config,
 }
 
 void TurnToPose::Update() {
+  SUBZERO_PROFILE_ZONE("TurnToPose::Update");
+
   if (!m_targetPose && !m_targetAngle)
     return;
 
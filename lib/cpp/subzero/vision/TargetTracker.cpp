@@ -6,6 +6,9 @@
 
 #include <ranges>
 
+#include "subzero/profiling/LoopProfiler.h"
+#include "subzero/utils/DistanceEstimation.h"
+
 using namespace subzero;
 
 TargetTracker::TargetTracker(TargetTrackerConfig config,
@@ -16,6 +19,8 @@ TargetTracker::TargetTracker(TargetTrackerConfig config,
 }
 
 std::vector<DetectedObject> TargetTracker::GetTargets() {
+  SUBZERO_PROFILE_ZONE("TargetTracker::GetTargets");
+
   if (!frc::RobotBase::IsReal()) {
     static int counter = 0;
     return {
@@ -40,7 +45,16 @@ std::vector<DetectedObject> TargetTracker::GetTargets() {
     };
   }
 
-  auto llResult = LimelightHelpers::getLatestResults(m_config.limelightName);
+  std::string json = LimelightHelpers::getJSONDump(m_config.limelightName);
+  if (m_inputObserver) {
+    m_inputObserver(json);
+  }
+
+  return GetTargets(LimelightHelpers::parseResults(json));
+}
+
+std::vector<DetectedObject> TargetTracker::GetTargets(
+    const LimelightHelpers::LimelightResultsClass &llResult) {
   auto &detectionResults = llResult.targetingResults.DetectionResults;
 
   std::vector<DetectedObject> objects;
@@ -162,45 +176,56 @@ TargetTracker::GetTargetPose(const DetectedObject &object) {
 }
 
 units::inch_t TargetTracker::GetDistanceToTarget(const DetectedObject &target) {
+  DistanceEstimate estimate = EstimateDistance(target);
+
+  frc::SmartDashboard::PutNumber("TargetTracker Pixel Width",
+                                 estimate.pixelWidth);
+  frc::SmartDashboard::PutString(
+      "TargetTracker otherDistance",
+      std::to_string(estimate.widthDistance.value()) + " in");
+  frc::SmartDashboard::PutString(
+      "TargetTracker combinedDistance",
+      std::to_string(estimate.combinedDistance.value()) + " in");
+
+  return estimate.combinedDistance;
+}
+
+TargetTracker::DistanceEstimate
+TargetTracker::EstimateDistance(const DetectedObject &target) const {
   units::degree_t targetOffsetVertical = target.centerY;
   units::degree_t verticalDelta = targetOffsetVertical + m_config.cameraAngle;
   units::radian_t verticalAngle = verticalDelta.convert<units::radian>();
 
   DetectedCorners corners = target.detectedCorners;
   double pixelWidth = corners.bottomRight.x - corners.bottomLeft.x;
-  frc::SmartDashboard::PutNumber("TargetTracker Pixel Width", pixelWidth);
-
-  auto otherDistance =
-      // TODO: Replace with constant
-      // This ensures we don't get a wildly small width (= very far away) if
-      // bounding box is wrong/missing
-      pixelWidth > 3
-          ? ((m_config.gamepieceWidth * m_config.focalLength) / pixelWidth)
-          : 0_in;
-
-  units::inch_t heightDelta = -m_config.cameraLensHeight;
-  units::inch_t distance = heightDelta / tan(verticalAngle.value());
-  frc::SmartDashboard::PutString("TargetTracker otherDistance",
-                                 std::to_string(otherDistance.value()) + " in");
-
-  auto combinedDistance =
-      (distance * m_config.trigDistancePercentage) +
-      (otherDistance * (1 - m_config.trigDistancePercentage));
-  frc::SmartDashboard::PutString("TargetTracker combinedDistance",
-                                 std::to_string(otherDistance.value()) + " in");
-
-  return combinedDistance;
+
+  auto estimate = DistanceEstimation::EstimateDistance(
+      verticalAngle.value(), units::inch_t(m_config.cameraLensHeight).value(),
+      pixelWidth, units::inch_t(m_config.gamepieceWidth).value(),
+      m_config.focalLength.value(), m_config.trigDistancePercentage);
+
+  return {estimate.pixelWidth, units::inch_t(estimate.widthDistance),
+          units::inch_t(estimate.combinedDistance)};
 }
 
 void TargetTracker::SortTargetsByProximity(
     std::vector<DetectedObject> &objects) {
-  std::sort(objects.begin(), objects.end(),
-            [this](const auto &a, const auto &b) {
-              auto distanceA = GetDistanceToTarget(a);
-              auto distanceB = GetDistanceToTarget(b);
+  SUBZERO_PROFILE_ZONE("TargetTracker::SortTargetsByProximity");
+
+  // Estimate each distance once instead of twice per comparison
+  std::vector<std::pair<units::inch_t, DetectedObject>> byDistance;
+  byDistance.reserve(objects.size());
+  for (auto &object : objects) {
+    byDistance.emplace_back(EstimateDistance(object).combinedDistance,
+                            std::move(object));
+  }
+
+  std::sort(byDistance.begin(), byDistance.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
 
-              return distanceA < distanceB;
-            });
+  for (size_t i = 0; i < objects.size(); i++) {
+    objects[i] = std::move(byDistance[i].second);
+  }
 }
 
 void TargetTracker::PublishTrackedTarget(const TrackedTarget &target,
@@ -0,0 +1,347 @@
+#include "subzero/vision/VisionReplay.h"
+
+#include <frc/DataLogManager.h>
+#include <photon/dataflow/structures/Packet.h>
+#include <units/math.h>
+#include <wpi/DataLogReader.h>
+#include <wpi/MemoryBuffer.h>
+#include <wpi/struct/Struct.h>
+#include <wpi/timestamp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <unordered_map>
+
+#include "subzero/logging/ConsoleLogger.h"
+
+using namespace subzero;
+
+constexpr std::string_view kLimelightPrefix = "/Replay/Limelight/";
+constexpr std::string_view kDetectionsPrefix = "/Replay/Detections/";
+constexpr std::string_view kPhotonPrefix = "/Replay/Photon/";
+constexpr std::string_view kOutputPrefix = "/Replay/Output/";
+constexpr std::string_view kRobotPoseName = "/Replay/RobotPose";
+constexpr std::string_view kGyroName = "/Replay/Odometry/Gyro";
+constexpr std::string_view kModulesName = "/Replay/Odometry/Modules";
+
+VisionReplayRecorder::VisionReplayRecorder(wpi::log::DataLog *log)
+    : m_log{log ? *log : frc::DataLogManager::GetLog()} {}
+
+void VisionReplayRecorder::RecordLimelightJson(std::string_view limelightName,
+                                               std::string_view json) {
+  getEntry(m_jsonEntries, kLimelightPrefix, limelightName).Append(json);
+}
+
+void VisionReplayRecorder::RecordDetections(
+    std::string_view source, std::span<const double> detections) {
+  getEntry(m_detectionEntries, kDetectionsPrefix, source).Append(detections);
+}
+
+void VisionReplayRecorder::RecordPhotonResult(
+    std::string_view cameraName, const photon::PhotonPipelineResult &result) {
+  // Photon's own wire format, the same bytes the camera publishes
+  photon::Packet packet;
+  packet.Pack<photon::PhotonPipelineResult>(result);
+
+  // The receive time isn't in the packet, so it's kept as the record's
+  // timestamp; the observer runs up to a loop after NT received the frame
+  int64_t received = std::llround(
+      units::microsecond_t(result.GetTimestamp() + result.GetLatency())
+          .value());
+  getEntry(m_photonEntries, kPhotonPrefix, cameraName)
+      .Append(packet.GetData(), received > 0 ? received : wpi::Now());
+}
+
+void VisionReplayRecorder::RecordRobotPose(const frc::Pose2d &pose) {
+  getEntry(m_poseEntries, kRobotPoseName, "").Append(pose);
+}
+
+void VisionReplayRecorder::RecordOdometry(
+    const frc::Rotation2d &gyroAngle,
+    std::span<const frc::SwerveModulePosition> modulePositions) {
+  if (!m_gyroEntry) {
+    m_gyroEntry.emplace(m_log, kGyroName);
+    m_moduleEntry.emplace(m_log, kModulesName);
+  }
+
+  // The same timestamp on both is what pairs them up again when loading
+  int64_t now = wpi::Now();
+  m_gyroEntry->Append(gyroAngle, now);
+  m_moduleEntry->Append(modulePositions, now);
+}
+
+void VisionReplayRecorder::RecordOutput(std::string_view name,
+                                        const frc::Pose2d &pose) {
+  getEntry(m_poseEntries, kOutputPrefix, name).Append(pose);
+}
+
+std::optional<VisionReplayer> VisionReplayer::Load(std::string_view path) {
+  auto buffer = wpi::MemoryBuffer::GetFile(path);
+  if (!buffer) {
+    ConsoleWriter.logError("VisionReplayer", "Unable to read %s",
+                           std::string{path}.c_str());
+    return std::nullopt;
+  }
+
+  wpi::log::DataLogReader reader{std::move(*buffer)};
+  if (!reader.IsValid()) {
+    ConsoleWriter.logError("VisionReplayer", "%s is not a DataLog",
+                           std::string{path}.c_str());
+    return std::nullopt;
+  }
+
+  struct EntryInfo {
+    std::optional<RecordKind> kind;
+    std::string name;
+  };
+
+  VisionReplayer replayer;
+  std::unordered_map<int, EntryInfo> entries;
+  // Waiting for the module positions appended with it
+  std::optional<std::pair<int64_t, frc::Rotation2d>> pendingGyro;
+
+  for (const auto &record : reader) {
+    if (record.IsStart()) {
+      wpi::log::StartRecordData start;
+      if (!record.GetStartData(&start)) {
+        continue;
+      }
+
+      // Outputs keep an empty kind and go to the references instead
+      EntryInfo info;
+      if (start.name.starts_with(kLimelightPrefix)) {
+        info = {RecordKind::LimelightJson,
+                std::string{start.name.substr(kLimelightPrefix.size())}};
+      } else if (start.name.starts_with(kDetectionsPrefix)) {
+        info = {RecordKind::Detections,
+                std::string{start.name.substr(kDetectionsPrefix.size())}};
+      } else if (start.name.starts_with(kPhotonPrefix)) {
+        info = {RecordKind::PhotonResult,
+                std::string{start.name.substr(kPhotonPrefix.size())}};
+      } else if (start.name == kRobotPoseName) {
+        info = {RecordKind::RobotPose, ""};
+      } else if (start.name == kGyroName || start.name == kModulesName) {
+        info = {RecordKind::Odometry, std::string{start.name}};
+      } else if (start.name.starts_with(kOutputPrefix)) {
+        info = {std::nullopt,
+                std::string{start.name.substr(kOutputPrefix.size())}};
+      } else {
+        continue;
+      }
+      entries[start.entry] = info;
+      continue;
+    }
+
+    if (record.IsControl()) {
+      continue;
+    }
+
+    auto it = entries.find(record.GetEntry());
+    if (it == entries.end()) {
+      continue;
+    }
+    const EntryInfo &info = it->second;
+    int64_t timestamp = record.GetTimestamp();
+    auto raw = record.GetRaw();
+
+    if (!info.kind || *info.kind == RecordKind::RobotPose) {
+      if (raw.size() < wpi::GetStructSize<frc::Pose2d>()) {
+        continue;
+      }
+      auto pose = wpi::UnpackStruct<frc::Pose2d>(raw);
+      if (info.kind) {
+        replayer.m_records.push_back(
+            {timestamp, RecordKind::RobotPose, info.name, pose});
+      } else {
+        replayer.m_references[info.name].emplace_back(timestamp, pose);
+      }
+      continue;
+    }
+
+    switch (*info.kind) {
+    case RecordKind::LimelightJson: {
+      std::string_view json;
+      if (record.GetString(&json)) {
+        replayer.m_records.push_back(
+            {timestamp, RecordKind::LimelightJson, info.name,
+             std::string{json}});
+      }
+      break;
+    }
+    case RecordKind::Detections: {
+      std::vector<double> detections;
+      if (record.GetDoubleArray(&detections)) {
+        replayer.m_records.push_back({timestamp, RecordKind::Detections,
+                                      info.name, std::move(detections)});
+      }
+      break;
+    }
+    case RecordKind::PhotonResult: {
+      photon::Packet packet{std::vector<uint8_t>(raw.begin(), raw.end())};
+      auto result = packet.Unpack<photon::PhotonPipelineResult>();
+      // GetTimestamp() is measured from the receive time, which was
+      // recorded as the record's timestamp
+      result.SetReceiveTimestamp(units::microsecond_t(timestamp));
+      replayer.m_records.push_back({timestamp, RecordKind::PhotonResult,
+                                    info.name, std::move(result)});
+      break;
+    }
+    case RecordKind::Odometry: {
+      if (info.name == kGyroName) {
+        if (raw.size() >= wpi::GetStructSize<frc::Rotation2d>()) {
+          pendingGyro.emplace(timestamp,
+                              wpi::UnpackStruct<frc::Rotation2d>(raw));
+        }
+        break;
+      }
+
+      size_t moduleSize = wpi::GetStructSize<frc::SwerveModulePosition>();
+      if (!pendingGyro || pendingGyro->first != timestamp ||
+          raw.size() % moduleSize != 0) {
+        break;
+      }
+
+      OdometryInputs inputs{.gyroAngle = pendingGyro->second,
+                            .modulePositions = {}};
+      for (size_t offset = 0; offset < raw.size(); offset += moduleSize) {
+        inputs.modulePositions.push_back(
+            wpi::UnpackStruct<frc::SwerveModulePosition>(
+                raw.subspan(offset, moduleSize)));
+      }
+      pendingGyro.reset();
+      replayer.m_records.push_back(
+          {timestamp, RecordKind::Odometry, "", std::move(inputs)});
+      break;
+    }
+    default:
+      break;
+    }
+  }
+
+  // Entries are interleaved in time order already, but a stable sort keeps
+  // the replay deterministic even if a log isn't
+  std::stable_sort(
+      replayer.m_records.begin(), replayer.m_records.end(),
+      [](const auto &a, const auto &b) { return a.timestamp < b.timestamp; });
+  for (auto &[name, references] : replayer.m_references) {
+    std::stable_sort(
+        references.begin(), references.end(),
+        [](const auto &a, const auto &b) { return a.first < b.first; });
+  }
+
+  return replayer;
+}
+
+VisionReplayStats
+VisionReplayer::Run(const VisionReplayHandlers &handlers) const {
+  auto start = std::chrono::steady_clock::now();
+
+  for (const auto &record : m_records) {
+    units::second_t timestamp = units::microsecond_t(record.timestamp);
+
+    switch (record.kind) {
+    case RecordKind::LimelightJson:
+      if (handlers.limelightJson) {
+        handlers.limelightJson(timestamp, record.source,
+                               std::get<std::string>(record.value));
+      }
+      break;
+    case RecordKind::Detections:
+      if (handlers.detections) {
+        handlers.detections(timestamp, record.source,
+                            std::get<std::vector<double>>(record.value));
+      }
+      break;
+    case RecordKind::PhotonResult:
+      if (handlers.photonResult) {
+        handlers.photonResult(
+            timestamp, record.source,
+            std::get<photon::PhotonPipelineResult>(record.value));
+      }
+      break;
+    case RecordKind::RobotPose:
+      if (handlers.robotPose) {
+        handlers.robotPose(timestamp, std::get<frc::Pose2d>(record.value));
+      }
+      break;
+    case RecordKind::Odometry:
+      if (handlers.odometry) {
+        const auto &inputs = std::get<OdometryInputs>(record.value);
+        handlers.odometry(timestamp, inputs.gyroAngle, inputs.modulePositions);
+      }
+      break;
+    }
+  }
+
+  units::second_t wallTime = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count() *
+                             1_s;
+  units::second_t logDuration = 0_s;
+  if (!m_records.empty()) {
+    logDuration = units::microsecond_t(m_records.back().timestamp -
+                                       m_records.front().timestamp);
+  }
+
+  return {.records = m_records.size(),
+          .logDuration = logDuration,
+          .wallTime = wallTime,
+          .recordsPerSecond = wallTime > 0_s
+                                  ? m_records.size() / wallTime.value()
+                                  : 0.0};
+}
+
+void VisionReplayer::CompareOutput(std::string_view name,
+                                   units::second_t timestamp,
+                                   const frc::Pose2d &actual,
+                                   units::meter_t tolerance) {
+  auto it = m_references.find(name);
+  if (it == m_references.end() || it->second.empty()) {
+    return;
+  }
+  const auto &references = it->second;
+
+  // The reference recorded closest to the input that produced this output
+  int64_t time = units::microsecond_t(timestamp).to<int64_t>();
+  auto next = std::lower_bound(
+      references.begin(), references.end(), time,
+      [](const auto &reference, int64_t t) { return reference.first < t; });
+  if (next == references.end() ||
+      (next != references.begin() &&
+       time - std::prev(next)->first < next->first - time)) {
+    next = std::prev(next);
+  }
+
+  units::meter_t error =
+      actual.Translation().Distance(next->second.Translation());
+
+  auto comparison = m_comparisons.find(name);
+  if (comparison == m_comparisons.end()) {
+    comparison = m_comparisons.try_emplace(std::string{name}).first;
+  }
+  OutputComparison &stats = comparison->second;
+  stats.samples++;
+  stats.totalError += error;
+  stats.maxError = units::math::max(stats.maxError, error);
+  if (error > tolerance) {
+    stats.mismatches++;
+  }
+}
+
+void VisionReplayer::Report(const VisionReplayStats &stats) const {
+  ConsoleWriter.logInfo(
+      "VisionReplayer",
+      "Replayed %zu records covering %.1f s in %.3f s (%.0f records/s)",
+      stats.records, stats.logDuration.value(), stats.wallTime.value(),
+      stats.recordsPerSecond);
+
+  for (const auto &[name, comparison] : m_comparisons) {
+    ConsoleWriter.logInfo(
+        "VisionReplayer",
+        "%s: %zu samples, %zu mismatches, mean error %.4f m, max %.4f m",
+        name.c_str(), comparison.samples, comparison.mismatches,
+        comparison.totalError.value() / comparison.samples,
+        comparison.maxError.value());
+  }
+}
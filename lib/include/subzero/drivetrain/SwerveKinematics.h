@@ -0,0 +1,271 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+namespace subzero {
+
+/**
+ * Robot-relative chassis velocity.
+ */
+struct SwerveChassisSpeeds {
+  /** Forward velocity (in meters per second). */
+  double vx;
+  /** Leftward velocity (in meters per second). */
+  double vy;
+  /** Counter-clockwise angular velocity (in radians per second). */
+  double omega;
+};
+
+/**
+ * A module's velocity as robot-relative components; everything that only needs
+ * these can be evaluated at compile time.
+ */
+struct SwerveModuleVector {
+  double vx;
+  double vy;
+};
+
+/**
+ * A module's wheel speed and steering angle.
+ */
+struct SwerveModuleSpeed {
+  /** Wheel speed (in meters per second). */
+  double speed;
+  /** Steering angle (in radians). */
+  double angle;
+};
+
+/**
+ * A module's position relative to the robot's center (in meters).
+ */
+struct SwerveModuleLocation {
+  double x;
+  double y;
+};
+
+/**
+ * Fixed-size swerve kinematics that don't allocate or depend on WPILib, so they
+ * can run in hot loops and offline tools alike.
+ *
+ * @tparam N The number of modules.
+ */
+template <size_t N> class SwerveKinematics {
+public:
+  using ModuleLocations = std::array<SwerveModuleLocation, N>;
+  using ModuleVectors = std::array<SwerveModuleVector, N>;
+  using ModuleSpeeds = std::array<SwerveModuleSpeed, N>;
+
+  /**
+   * Constructs the kinematics and precomputes the least-squares solution used
+   * by forward kinematics.
+   *
+   * @param locations The location of each module relative to the robot's
+   * center.
+   */
+  constexpr explicit SwerveKinematics(const ModuleLocations &locations)
+      : m_locations{locations} {
+    // Forward kinematics solves the overdetermined system A * speeds = v,
+    // where each module contributes the rows [1, 0, -y] and [0, 1, x]. The
+    // normal equations only depend on the locations, so (A^T A)^-1 A^T is
+    // computed once here
+    double sumX = 0, sumY = 0, sumSquares = 0;
+    for (auto &location : m_locations) {
+      sumX += location.x;
+      sumY += location.y;
+      sumSquares += location.x * location.x + location.y * location.y;
+    }
+
+    double n = static_cast<double>(N);
+    // Symmetric A^T A = [[n, 0, -sumY], [0, n, sumX], [-sumY, sumX, sumSq]]
+    double a00 = n, a02 = -sumY, a11 = n, a12 = sumX, a22 = sumSquares;
+
+    double c00 = a11 * a22 - a12 * a12;
+    double c01 = a02 * a12;
+    double c02 = -a11 * a02;
+    double c11 = a00 * a22 - a02 * a02;
+    double c12 = -a00 * a12;
+    double c22 = a00 * a11;
+    double determinant = a00 * c00 + a02 * c02;
+
+    std::array<std::array<double, 3>, 3> inverse{
+        {{c00 / determinant, c01 / determinant, c02 / determinant},
+         {c01 / determinant, c11 / determinant, c12 / determinant},
+         {c02 / determinant, c12 / determinant, c22 / determinant}}};
+
+    for (size_t i = 0; i < N; i++) {
+      for (size_t row = 0; row < 3; row++) {
+        m_forward[row][2 * i] = inverse[row][0];
+        m_forward[row][2 * i + 1] = inverse[row][1];
+        // The rotation column of A^T is -y for vx and x for vy
+        m_forward[row][2 * i] += -m_locations[i].y * inverse[row][2];
+        m_forward[row][2 * i + 1] += m_locations[i].x * inverse[row][2];
+      }
+    }
+  }
+
+  /**
+   * Performs inverse kinematics.
+   *
+   * @param speeds The desired chassis speeds.
+   * @param center The center of rotation relative to the robot's center.
+   * @return The velocity of each module.
+   */
+  constexpr ModuleVectors
+  ToModuleVectors(const SwerveChassisSpeeds &speeds,
+                  SwerveModuleLocation center = {0, 0}) const {
+    ModuleVectors vectors{};
+    for (size_t i = 0; i < N; i++) {
+      vectors[i] = {speeds.vx - speeds.omega * (m_locations[i].y - center.y),
+                    speeds.vy + speeds.omega * (m_locations[i].x - center.x)};
+    }
+    return vectors;
+  }
+
+  /**
+   * Performs inverse kinematics. A module that isn't moving gets an angle of
+   * 0; use Optimize() to keep it where it is.
+   *
+   * @param speeds The desired chassis speeds.
+   * @param center The center of rotation relative to the robot's center.
+   * @return The speed and angle of each module.
+   */
+  ModuleSpeeds ToModuleSpeeds(const SwerveChassisSpeeds &speeds,
+                              SwerveModuleLocation center = {0, 0}) const {
+    ModuleVectors vectors = ToModuleVectors(speeds, center);
+    ModuleSpeeds moduleSpeeds;
+    for (size_t i = 0; i < N; i++) {
+      moduleSpeeds[i] = {std::hypot(vectors[i].vx, vectors[i].vy),
+                         std::atan2(vectors[i].vy, vectors[i].vx)};
+    }
+    return moduleSpeeds;
+  }
+
+  /**
+   * Performs forward kinematics with a least-squares fit over all modules.
+   *
+   * @param vectors The measured velocity of each module.
+   * @return The chassis speeds.
+   */
+  constexpr SwerveChassisSpeeds
+  ToChassisSpeeds(const ModuleVectors &vectors) const {
+    std::array<double, 3> result{0, 0, 0};
+    for (size_t row = 0; row < 3; row++) {
+      for (size_t i = 0; i < N; i++) {
+        result[row] += m_forward[row][2 * i] * vectors[i].vx +
+                       m_forward[row][2 * i + 1] * vectors[i].vy;
+      }
+    }
+    return {result[0], result[1], result[2]};
+  }
+
+  /**
+   * Performs forward kinematics with a least-squares fit over all modules.
+   *
+   * @param moduleSpeeds The measured speed and angle of each module.
+   * @return The chassis speeds.
+   */
+  SwerveChassisSpeeds ToChassisSpeeds(const ModuleSpeeds &moduleSpeeds) const {
+    ModuleVectors vectors;
+    for (size_t i = 0; i < N; i++) {
+      vectors[i] = {moduleSpeeds[i].speed * std::cos(moduleSpeeds[i].angle),
+                    moduleSpeeds[i].speed * std::sin(moduleSpeeds[i].angle)};
+    }
+    return ToChassisSpeeds(vectors);
+  }
+
+  /**
+   * Scales all wheel speeds down evenly so that none exceeds the max, keeping
+   * the direction of motion.
+   *
+   * @param moduleSpeeds The module speeds to scale in place.
+   * @param maxSpeed The max attainable wheel speed (in meters per second).
+   */
+  static constexpr void DesaturateWheelSpeeds(ModuleSpeeds &moduleSpeeds,
+                                              double maxSpeed) {
+    double fastest = 0;
+    for (auto &moduleSpeed : moduleSpeeds) {
+      double speed =
+          moduleSpeed.speed < 0 ? -moduleSpeed.speed : moduleSpeed.speed;
+      fastest = speed > fastest ? speed : fastest;
+    }
+
+    if (fastest > maxSpeed) {
+      for (auto &moduleSpeed : moduleSpeeds) {
+        moduleSpeed.speed = moduleSpeed.speed / fastest * maxSpeed;
+      }
+    }
+  }
+
+  /**
+   * Minimizes the change in steering angle by reversing the wheel when the
+   * target is more than 90 degrees away, then scales the speed by the cosine
+   * of the remaining error so the wheel doesn't drive sideways while turning.
+   *
+   * @param desired The desired speed and angle.
+   * @param currentAngle The module's current steering angle (in radians).
+   * @return The optimized speed, and an angle within 90 degrees of the current
+   * one.
+   */
+  static SwerveModuleSpeed Optimize(SwerveModuleSpeed desired,
+                                    double currentAngle) {
+    double error = std::remainder(desired.angle - currentAngle,
+                                  2 * std::numbers::pi);
+    if (std::abs(error) > std::numbers::pi / 2) {
+      desired.speed = -desired.speed;
+      error = std::remainder(error + std::numbers::pi, 2 * std::numbers::pi);
+    }
+
+    // Keeping the angle next to the current one avoids unwinding continuous
+    // steering encoders
+    desired.angle = currentAngle + error;
+    desired.speed *= std::cos(error);
+    return desired;
+  }
+
+  /**
+   * Corrects for the skew caused by applying chassis speeds for a discrete
+   * time step while rotating. The returned speeds, held for the time step,
+   * follow the arc that ends at the pose the original speeds would reach if
+   * the translation and rotation were applied at the same time.
+   *
+   * @param speeds The continuous chassis speeds.
+   * @param dt The length of the time step (in seconds).
+   * @return The discretized chassis speeds.
+   */
+  static SwerveChassisSpeeds Discretize(const SwerveChassisSpeeds &speeds,
+                                        double dt) {
+    // Log map of the pose (vx * dt, vy * dt, omega * dt)
+    double dx = speeds.vx * dt;
+    double dy = speeds.vy * dt;
+    double dtheta = speeds.omega * dt;
+
+    double halfDtheta = dtheta / 2;
+    double cosMinusOne = std::cos(dtheta) - 1;
+    double halfThetaByTanOfHalfDtheta =
+        std::abs(cosMinusOne) < 1e-9
+            ? 1.0 - dtheta * dtheta / 12.0
+            : -(halfDtheta * std::sin(dtheta)) / cosMinusOne;
+
+    return {(dx * halfThetaByTanOfHalfDtheta + dy * halfDtheta) / dt,
+            (dy * halfThetaByTanOfHalfDtheta - dx * halfDtheta) / dt,
+            speeds.omega};
+  }
+
+  /**
+   * Gets the module locations.
+   *
+   * @return The location of each module.
+   */
+  constexpr const ModuleLocations &GetModuleLocations() const {
+    return m_locations;
+  }
+
+private:
+  ModuleLocations m_locations;
+  /** (A^T A)^-1 A^T; interleaved vx and vy columns per module. */
+  std::array<std::array<double, 2 * N>, 3> m_forward{};
+};
+} // namespace subzero
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+#include "subzero/drivetrain/SwerveKinematics.h"
+
+namespace subzero {
+
+/**
+ * Physical limits of each swerve module.
+ */
+struct SwerveModuleLimits {
+  /** Max wheel speed (in meters per second). */
+  double maxWheelSpeed;
+  /** Max change in wheel speed (in meters per second squared). */
+  double maxWheelAcceleration;
+  /** Max steering rate (in radians per second). */
+  double maxSteerRate;
+};
+
+/**
+ * Chassis speeds together with the module states that produce them.
+ *
+ * @tparam N The number of modules.
+ */
+template <size_t N> struct SwerveSetpoint {
+  SwerveChassisSpeeds chassisSpeeds;
+  typename SwerveKinematics<N>::ModuleSpeeds moduleSpeeds;
+};
+
+/**
+ * Moves from the previous setpoint toward the desired chassis speeds by the
+ * largest step that every module can follow, given how fast it can steer and
+ * change wheel speed. Unlike slewing translation and rotation separately, the
+ * result never asks a module for a state it can't reach, so the wheels don't
+ * scrub. Nothing is allocated.
+ *
+ * @tparam N The number of modules.
+ */
+template <size_t N> class SwerveSetpointGenerator {
+public:
+  using Setpoint = SwerveSetpoint<N>;
+  using ModuleSpeeds = typename SwerveKinematics<N>::ModuleSpeeds;
+
+  /**
+   * Constructs the generator.
+   *
+   * @param kinematics The drivetrain's kinematics.
+   * @param limits The limits of each module.
+   * @param iterations Bisection steps; each one halves the remaining error in
+   * the step size.
+   */
+  SwerveSetpointGenerator(const SwerveKinematics<N> &kinematics,
+                          SwerveModuleLimits limits, int iterations = 10)
+      : m_kinematics{kinematics}, m_limits{limits}, m_iterations{iterations} {}
+
+  /**
+   * Generates the next setpoint.
+   *
+   * @param previous The setpoint returned by the previous call, or the
+   * measured state on the first call.
+   * @param desired The desired chassis speeds.
+   * @param dt The time until the next call (in seconds).
+   * @return The next setpoint.
+   */
+  Setpoint Generate(const Setpoint &previous,
+                    const SwerveChassisSpeeds &desired, double dt) const {
+    Setpoint candidate;
+    if (TryStep(previous, desired, 1.0, dt, candidate)) {
+      return candidate;
+    }
+
+    if (IsStopped(previous) && TurnInPlace(previous, desired, dt, candidate)) {
+      return candidate;
+    }
+
+    // Standing still at the previous speeds is always feasible; find the
+    // largest fraction of the change that still is
+    Setpoint best = previous;
+    double feasible = 0.0;
+    double infeasible = 1.0;
+    for (int i = 0; i < m_iterations; i++) {
+      double step = (feasible + infeasible) / 2;
+      if (TryStep(previous, desired, step, dt, candidate)) {
+        feasible = step;
+        best = candidate;
+      } else {
+        infeasible = step;
+      }
+    }
+
+    return best;
+  }
+
+private:
+  /**
+   * Build the setpoint a fraction of the way to the desired speeds and check
+   * it against the module limits.
+   *
+   * @return true if every module can reach its state within dt
+   */
+  bool TryStep(const Setpoint &previous, const SwerveChassisSpeeds &desired,
+               double step, double dt, Setpoint &result) const {
+    result.chassisSpeeds = {
+        previous.chassisSpeeds.vx +
+            step * (desired.vx - previous.chassisSpeeds.vx),
+        previous.chassisSpeeds.vy +
+            step * (desired.vy - previous.chassisSpeeds.vy),
+        previous.chassisSpeeds.omega +
+            step * (desired.omega - previous.chassisSpeeds.omega)};
+
+    result.moduleSpeeds = m_kinematics.ToModuleSpeeds(result.chassisSpeeds);
+    SwerveKinematics<N>::DesaturateWheelSpeeds(result.moduleSpeeds,
+                                               m_limits.maxWheelSpeed);
+    // Desaturating may have slowed the chassis down
+    result.chassisSpeeds = m_kinematics.ToChassisSpeeds(result.moduleSpeeds);
+
+    double maxSteer = m_limits.maxSteerRate * dt;
+    double maxSpeedChange = m_limits.maxWheelAcceleration * dt;
+
+    for (size_t i = 0; i < N; i++) {
+      const SwerveModuleSpeed &last = previous.moduleSpeeds[i];
+      SwerveModuleSpeed &next = result.moduleSpeeds[i];
+
+      double steer = Orient(last.angle, next);
+      if (steer > maxSteer ||
+          std::abs(next.speed - last.speed) > maxSpeedChange) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Any motion from a stop needs the wheels to already point the right way,
+   * so turn them in place toward the desired speeds first.
+   *
+   * @return true if any module still has to steer further than it can in dt
+   */
+  bool TurnInPlace(const Setpoint &previous, const SwerveChassisSpeeds &desired,
+                   double dt, Setpoint &result) const {
+    double maxSteer = m_limits.maxSteerRate * dt;
+    bool turning = false;
+
+    result.chassisSpeeds = {0, 0, 0};
+    result.moduleSpeeds = m_kinematics.ToModuleSpeeds(desired);
+    for (size_t i = 0; i < N; i++) {
+      double last = previous.moduleSpeeds[i].angle;
+      double steer = Orient(last, result.moduleSpeeds[i]);
+      double error = result.moduleSpeeds[i].angle - last;
+
+      turning |= steer > maxSteer;
+      result.moduleSpeeds[i] = {
+          0, steer > maxSteer ? last + std::copysign(maxSteer, error)
+                              : result.moduleSpeeds[i].angle};
+    }
+
+    return turning;
+  }
+
+  /**
+   * Flip the module state if that's a shorter turn, and express its angle
+   * next to the previous one.
+   *
+   * @param lastAngle The module's previous angle (in radians).
+   * @param state The state to adjust in place.
+   * @return How far the module has to steer (in radians).
+   */
+  static double Orient(double lastAngle, SwerveModuleSpeed &state) {
+    if (state.speed == 0) {
+      // A stopped wheel can point anywhere, so leave it where it was
+      state.angle = lastAngle;
+      return 0;
+    }
+
+    double error =
+        std::remainder(state.angle - lastAngle, 2 * std::numbers::pi);
+    if (std::abs(error) > std::numbers::pi / 2) {
+      state.speed = -state.speed;
+      error = std::remainder(error + std::numbers::pi, 2 * std::numbers::pi);
+    }
+
+    state.angle = lastAngle + error;
+    return std::abs(error);
+  }
+
+  static bool IsStopped(const Setpoint &setpoint) {
+    for (auto &moduleSpeed : setpoint.moduleSpeeds) {
+      if (std::abs(moduleSpeed.speed) > 1e-6) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  SwerveKinematics<N> m_kinematics;
+  SwerveModuleLimits m_limits;
+  int m_iterations;
+};
+} // namespace subzero
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 namespace subzero {
 class SwerveUtils {
 public:
@@ -51,5 +53,18 @@ public:
    * @return An angle (in radians) from 0 and 2*PI (exclusive).
    */
   static double WrapAngle(double angle);
+
+  /**
+   * Batch version of AngleDifference(); the loop vectorizes with default
+   * flags. Results are bit-identical to the scalar version.
+   *
+   * @param angleA Angles (in radians).
+   * @param angleB An angle (in radians) for each of angleA.
+   * @param out Receives the differences; must be at least as long as angleA
+   * and may be the same span as either input.
+   */
+  static void AngleDifference(std::span<const double> angleA,
+                              std::span<const double> angleB,
+                              std::span<double> out);
 };
 } // namespace subzero
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <frc/Timer.h>
+#include <networktables/NetworkTableInstance.h>
+#include <units/time.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace subzero {
+
+/**
+ * @brief Publishes a single SmartDashboard value through an NT publisher that
+ * is created once. The value is only sent when it changes, and at most once
+ * per period; a change that arrives too early is sent by the first call after
+ * the period has elapsed
+ *
+ * @tparam TTopic nt::BooleanTopic, nt::DoubleTopic, nt::StringTopic, etc.
+ */
+template <typename TTopic> class RateLimitedPublisher {
+public:
+  using Value = typename TTopic::ValueType;
+  using Param = typename TTopic::ParamType;
+
+  /**
+   * @brief Construct a new RateLimitedPublisher
+   *
+   * @param key Key in SmartDashboard
+   * @param minPeriod Minimum time between two publishes; 0 only publishes on
+   * change
+   */
+  explicit RateLimitedPublisher(std::string_view key,
+                                units::second_t minPeriod = 0_s)
+      : m_publisher{TTopic{nt::NetworkTableInstance::GetDefault().GetTopic(
+                               "/SmartDashboard/" + std::string{key})}
+                        .Publish()},
+        m_minPeriod{minPeriod} {}
+
+  /**
+   * @brief Set the value to publish
+   *
+   * @param value
+   */
+  void Set(Param value) {
+    m_value = Value{value};
+    Flush();
+  }
+
+  /**
+   * @brief Set a value that is expensive to compute. The getter is only
+   * called while a dashboard is connected and the period has elapsed
+   *
+   * @tparam TGetter Callable returning the value
+   * @param getter
+   */
+  template <typename TGetter> void SetLazy(TGetter &&getter) {
+    if (!IsDashboardConnected() || !CanPublish()) {
+      return;
+    }
+
+    Set(getter());
+  }
+
+  /**
+   * @brief Publish the latest value if it hasn't been sent yet and the period
+   * has elapsed
+   *
+   */
+  void Flush() {
+    if (!m_value || m_value == m_published || !CanPublish()) {
+      return;
+    }
+
+    m_publisher.Set(m_value.value());
+    m_published = m_value;
+    if (m_minPeriod > 0_s) {
+      m_lastPublishTime = frc::Timer::GetFPGATimestamp();
+    }
+  }
+
+  /**
+   * @brief Whether any NT client, e.g. a dashboard, is connected
+   *
+   * @return bool
+   */
+  static inline bool IsDashboardConnected() {
+    return nt::NetworkTableInstance::GetDefault().IsConnected();
+  }
+
+private:
+  inline bool CanPublish() const {
+    return m_minPeriod <= 0_s || !m_lastPublishTime ||
+           frc::Timer::GetFPGATimestamp() - m_lastPublishTime.value() >=
+               m_minPeriod;
+  }
+
+  typename TTopic::PublisherType m_publisher;
+  units::second_t m_minPeriod;
+  std::optional<Value> m_value;
+  std::optional<Value> m_published;
+  std::optional<units::second_t> m_lastPublishTime;
+};
+} // namespace subzero
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "subzero/utils/UtilConstants.h"
+
+namespace subzero {
+
+/**
+ * @brief Takes log records from any thread without blocking and writes them to
+ * stdout in batches from a background thread. Records go through a bounded
+ * lock-free ring, so memory use is fixed; when it's full, records are dropped
+ * and counted rather than stalling the caller. Each record is stamped with the
+ * time it was pushed, since it may be written much later
+ *
+ * @remark Singleton class; never destroyed, so it's safe to push from other
+ * static destructors
+ */
+class AsyncLogBackend {
+public:
+  /**
+   * @brief Number of records the ring can hold; must be a power of 2
+   *
+   */
+  static constexpr size_t kCapacity = 1024;
+  static constexpr size_t kMaxKeyLength = 48;
+  static constexpr size_t kMaxMessageLength = 256;
+
+  static AsyncLogBackend &getInstance() {
+    // Deliberately leaked: loggers may still push while statics are being
+    // destroyed at exit
+    static AsyncLogBackend *instance = new AsyncLogBackend();
+
+    return *instance;
+  }
+
+  AsyncLogBackend(const AsyncLogBackend &) = delete;
+  AsyncLogBackend &operator=(const AsyncLogBackend &) = delete;
+
+  /**
+   * @brief Format a record and queue it. Formatting happens on the calling
+   * thread since the arguments don't outlive the call; only the write is
+   * deferred
+   *
+   * @param level
+   * @param key
+   * @param format printf-style format
+   * @param ap
+   * @return false if the ring was full and the record was dropped
+   */
+  bool Push(Logging::Level level, std::string_view key, const char *format,
+            va_list ap);
+
+  /**
+   * @brief Queue an already formatted message
+   *
+   * @param level
+   * @param key
+   * @param message
+   * @return false if the ring was full and the record was dropped
+   */
+  bool Push(Logging::Level level, std::string_view key,
+            std::string_view message);
+
+  /**
+   * @brief Block until every record queued so far has been written
+   *
+   */
+  void Flush();
+
+  /**
+   * @brief Park the writer thread instead of polling for records, e.g. while
+   * the ConsoleLogger writes synchronously. Pushing or calling Flush() while
+   * parked still gets records written
+   *
+   * @param paused
+   */
+  void SetPaused(bool paused);
+
+  /**
+   * @brief Append the "[seconds since startup] " prefix every console line
+   * starts with, whether it's written directly or queued
+   *
+   * @param out
+   * @param time When the line was logged
+   */
+  static void AppendTimestamp(std::string &out,
+                              std::chrono::steady_clock::time_point time);
+
+  /**
+   * @brief Get the number of records dropped because the ring was full
+   *
+   * @return uint64_t
+   */
+  inline uint64_t GetDroppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct Record {
+    std::chrono::steady_clock::time_point time;
+    Logging::Level level;
+    std::array<char, kMaxKeyLength> key;
+    std::array<char, kMaxMessageLength> message;
+  };
+
+  struct alignas(64) Cell {
+    std::atomic<size_t> sequence;
+    Record record;
+  };
+
+  AsyncLogBackend();
+
+  ~AsyncLogBackend() = delete;
+
+  /**
+   * @brief Claim a cell for writing
+   *
+   * @param position Set to the claimed position in the ring
+   * @return nullptr if the ring is full
+   */
+  Cell *Acquire(size_t &position);
+
+  void Run();
+
+  /**
+   * @brief Wake the writer if it's parked
+   *
+   */
+  void Wake();
+
+  /**
+   * @brief Write everything currently queued in one batch
+   *
+   * @return The number of records written
+   */
+  size_t Drain();
+
+  std::unique_ptr<Cell[]> m_cells;
+  alignas(64) std::atomic<size_t> m_enqueuePosition = 0;
+  alignas(64) size_t m_dequeuePosition = 0;
+  std::atomic<size_t> m_written = 0;
+  std::atomic<uint64_t> m_dropped = 0;
+  uint64_t m_reportedDropped = 0;
+  std::atomic<bool> m_paused = false;
+  /**
+   * @brief Bumped to wake the writer when it's parked
+   *
+   */
+  std::atomic<uint32_t> m_wakeups = 0;
+  std::string m_batch;
+  std::thread m_thread;
+};
+} // namespace subzero
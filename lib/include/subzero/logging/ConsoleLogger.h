@@ -1,9 +1,12 @@
 #ifndef CONSOLE_LOGGER_H
 #define CONSOLE_LOGGER_H
 
+#include <atomic>
 #include <iostream>
 #include <string>
+#include <string_view>
 
+#include "subzero/logging/AsyncLogBackend.h"
 #include "subzero/logging/ILogger.h"
 
 namespace subzero {
@@ -12,7 +15,7 @@ namespace subzero {
  *
  * @remark Singleton class
  */
-class ConsoleLogger : ILogger {
+class ConsoleLogger : public ILogger {
 public:
   static ConsoleLogger &getInstance() {
     static ConsoleLogger instance;
@@ -56,17 +59,61 @@ public:
   void logError(std::string key, wpi::Sendable *val) override;
   void logFatal(std::string key, wpi::Sendable *val) override;
 
+  void logMessage(Logging::Level level, std::string_view key,
+                  std::string_view message) override;
+
+  /**
+   * @brief Queue messages to be written by a background thread instead of
+   * writing them to stdout on the calling thread. Off by default
+   *
+   * @param async
+   */
+  void SetAsync(bool async);
+
+  /**
+   * @brief Block until every queued message has been written
+   *
+   */
+  void Flush();
+
 private:
   ConsoleLogger();
 
+  /**
+   * @brief Writes out anything still queued and goes back to writing
+   * directly, so messages logged later during exit aren't lost
+   *
+   */
+  ~ConsoleLogger();
+
   void log(Logging::Level level, std::string key, std::string fmt, va_list ap) {
     if (!shouldLog(level))
       return;
 
-    std::string val = formatString(fmt, ap);
-    std::cout << levelToString(level) << " - " << key << ": " << val
-              << std::endl;
+    if (m_async) {
+      AsyncLogBackend::getInstance().Push(level, key, fmt.c_str(), ap);
+      if (level == Logging::Level::FATAL) {
+        // Don't lose the message if the robot program is about to go down
+        Flush();
+      }
+      return;
+    }
+
+    writeLine(level, key, formatString(fmt, ap));
   }
+
+  /**
+   * @brief Write a line on the calling thread, in the same format the
+   * AsyncLogBackend uses
+   *
+   * @param level
+   * @param key
+   * @param message
+   */
+  void writeLine(Logging::Level level, std::string_view key,
+                 std::string_view message);
+
+  std::atomic<bool> m_async = false;
 };
 } // namespace subzero
 
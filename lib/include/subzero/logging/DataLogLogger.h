@@ -0,0 +1,143 @@
+#pragma once
+
+#include <frc/geometry/Pose2d.h>
+#include <wpi/DataLog.h>
+#include <wpi/StringMap.h>
+
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "subzero/logging/ILogger.h"
+
+namespace subzero {
+
+/**
+ * @brief Writes typed entries to the robot's DataLog file (see
+ * frc::DataLogManager) so they can be replayed in AdvantageScope. Values keep
+ * their type: numbers stay numbers and poses are struct-serialized instead of
+ * going through JSON. Entries are created on first use and cached by key, so
+ * later calls only append to the log buffer. A key gets /Logger/<key> for the
+ * type it's first logged as; values of any other type go to
+ * /Logger/<key>.<type>, since DataLog drops values of the wrong type
+ *
+ * @remark Singleton class; safe to call from any thread
+ */
+class DataLogLogger : public ILogger {
+public:
+  static DataLogLogger &getInstance() {
+    static DataLogLogger instance;
+
+    return instance;
+  }
+
+  void logVerbose(std::string key, const std::string format, ...) override;
+  void logInfo(std::string key, const std::string format, ...) override;
+  void logWarning(std::string key, const std::string format, ...) override;
+  void logError(std::string key, const std::string format, ...) override;
+  void logFatal(std::string key, const std::string format, ...) override;
+
+  void logInfo(std::string key, int val) override;
+  void logVerbose(std::string key, int val) override;
+  void logWarning(std::string key, int val) override;
+  void logError(std::string key, int val) override;
+  void logFatal(std::string key, int val) override;
+
+  void logInfo(std::string key, double val) override;
+  void logVerbose(std::string key, double val) override;
+  void logWarning(std::string key, double val) override;
+  void logError(std::string key, double val) override;
+  void logFatal(std::string key, double val) override;
+
+  void logInfo(std::string key, bool val) override;
+  void logVerbose(std::string key, bool val) override;
+  void logWarning(std::string key, bool val) override;
+  void logError(std::string key, bool val) override;
+  void logFatal(std::string key, bool val) override;
+
+  void logInfo(std::string key, frc::Pose2d &val) override;
+  void logVerbose(std::string key, frc::Pose2d &val) override;
+  void logWarning(std::string key, frc::Pose2d &val) override;
+  void logError(std::string key, frc::Pose2d &val) override;
+  void logFatal(std::string key, frc::Pose2d &val) override;
+
+  void logInfo(std::string key, wpi::Sendable *val) override;
+  void logVerbose(std::string key, wpi::Sendable *val) override;
+  void logWarning(std::string key, wpi::Sendable *val) override;
+  void logError(std::string key, wpi::Sendable *val) override;
+  void logFatal(std::string key, wpi::Sendable *val) override;
+
+  void logMessage(Logging::Level level, std::string_view key,
+                  std::string_view message) override;
+
+private:
+  /**
+   * @brief Prefix of every entry name, keeping these apart from the entries
+   * NetworkTables mirrors into the log
+   *
+   */
+  static constexpr std::string_view kEntryPrefix = "/Logger/";
+
+  DataLogLogger();
+
+  void logFormat(Logging::Level level, std::string_view key,
+                 const std::string format, va_list ap);
+
+  /**
+   * @brief Append to the entry for a key, creating it on first use
+   *
+   * @tparam TEntry
+   * @tparam TValue
+   * @param entries Cached entries of the value's type
+   * @param key
+   * @param value
+   */
+  template <typename TEntry, typename TValue>
+  void append(wpi::StringMap<TEntry> &entries, std::string_view key,
+              const TValue &value) {
+    std::scoped_lock lock{m_mutex};
+
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+      it = entries
+               .try_emplace(std::string{key}, m_log,
+                            entryName(key, typeName<TEntry>()))
+               .first;
+    }
+    it->second.Append(value);
+  }
+
+  template <typename TEntry> static constexpr std::string_view typeName() {
+    if constexpr (std::is_same_v<TEntry,
+                                 wpi::log::StructLogEntry<frc::Pose2d>>) {
+      return "struct:Pose2d";
+    } else {
+      return TEntry::kDataType;
+    }
+  }
+
+  /**
+   * @brief Name a new entry, suffixing the type if the key already has an
+   * entry of another type
+   *
+   * @param key
+   * @param type
+   * @return std::string
+   */
+  std::string entryName(std::string_view key, std::string_view type);
+
+  wpi::log::DataLog &m_log;
+  std::mutex m_mutex;
+  /**
+   * @brief Type of the unsuffixed entry for each key
+   *
+   */
+  wpi::StringMap<std::string_view> m_keyTypes;
+  wpi::StringMap<wpi::log::StringLogEntry> m_stringEntries;
+  wpi::StringMap<wpi::log::IntegerLogEntry> m_integerEntries;
+  wpi::StringMap<wpi::log::DoubleLogEntry> m_doubleEntries;
+  wpi::StringMap<wpi::log::BooleanLogEntry> m_booleanEntries;
+  wpi::StringMap<wpi::log::StructLogEntry<frc::Pose2d>> m_poseEntries;
+};
+} // namespace subzero
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <units/time.h>
+#include <wpi/StringMap.h>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "subzero/logging/ILogger.h"
+
+namespace subzero {
+
+/**
+ * @brief Filters applied by a sink, tracked separately for each key
+ *
+ */
+struct LogSinkOptions {
+  /**
+   * @brief Messages below this level are not sent to the sink
+   *
+   */
+  Logging::Level minLevel = Logging::Level::VERBOSE;
+  /**
+   * @brief Minimum time between two messages with the same key; 0 disables
+   * rate limiting
+   *
+   */
+  units::second_t minPeriodPerKey = 0_s;
+  /**
+   * @brief Only every nth message with the same key is sent; 1 sends all of
+   * them
+   *
+   */
+  int sampleEvery = 1;
+  /**
+   * @brief Messages at or above this level skip rate limiting and sampling,
+   * so repeated errors are never dropped
+   *
+   */
+  Logging::Level unfilteredLevel = Logging::Level::WARNING;
+};
+
+/**
+ * @brief Formats each message once and passes it on to every registered sink
+ * whose filters accept it. Each sink has its own minimum level, per-key rate
+ * limit and sampling, so a key logged every loop can be throttled on the
+ * console while still reaching a DataLog at full rate
+ *
+ * @remark Singleton class; starts with the ConsoleLogger as its only sink
+ */
+class FanoutLogger : public ILogger {
+public:
+  static FanoutLogger &getInstance() {
+    static FanoutLogger instance;
+
+    return instance;
+  }
+
+  /**
+   * @brief Register a sink. Not thread-safe; add sinks before logging from
+   * other threads
+   *
+   * @param sink Must outlive the FanoutLogger; typically another singleton
+   * @param options
+   */
+  void AddSink(ILogger *sink, LogSinkOptions options = {});
+
+  /**
+   * @brief Unregister every sink, including the default console sink
+   *
+   */
+  void ClearSinks();
+
+  void logVerbose(std::string key, const std::string format, ...) override;
+  void logInfo(std::string key, const std::string format, ...) override;
+  void logWarning(std::string key, const std::string format, ...) override;
+  void logError(std::string key, const std::string format, ...) override;
+  void logFatal(std::string key, const std::string format, ...) override;
+
+  void logInfo(std::string key, int val) override;
+  void logVerbose(std::string key, int val) override;
+  void logWarning(std::string key, int val) override;
+  void logError(std::string key, int val) override;
+  void logFatal(std::string key, int val) override;
+
+  void logInfo(std::string key, double val) override;
+  void logVerbose(std::string key, double val) override;
+  void logWarning(std::string key, double val) override;
+  void logError(std::string key, double val) override;
+  void logFatal(std::string key, double val) override;
+
+  void logInfo(std::string key, bool val) override;
+  void logVerbose(std::string key, bool val) override;
+  void logWarning(std::string key, bool val) override;
+  void logError(std::string key, bool val) override;
+  void logFatal(std::string key, bool val) override;
+
+  void logInfo(std::string key, frc::Pose2d &val) override;
+  void logVerbose(std::string key, frc::Pose2d &val) override;
+  void logWarning(std::string key, frc::Pose2d &val) override;
+  void logError(std::string key, frc::Pose2d &val) override;
+  void logFatal(std::string key, frc::Pose2d &val) override;
+
+  void logInfo(std::string key, wpi::Sendable *val) override;
+  void logVerbose(std::string key, wpi::Sendable *val) override;
+  void logWarning(std::string key, wpi::Sendable *val) override;
+  void logError(std::string key, wpi::Sendable *val) override;
+  void logFatal(std::string key, wpi::Sendable *val) override;
+
+  void logMessage(Logging::Level level, std::string_view key,
+                  std::string_view message) override;
+
+private:
+  struct KeyState {
+    std::optional<units::second_t> lastSent;
+    uint64_t count = 0;
+  };
+
+  struct Sink {
+    ILogger *logger;
+    LogSinkOptions options;
+    wpi::StringMap<KeyState> keys;
+  };
+
+  FanoutLogger();
+
+  /**
+   * @brief Check a sink's filters, updating its per-key state. Call with
+   * m_filterMutex held
+   *
+   * @param sink
+   * @param level
+   * @param key
+   * @param now
+   * @return true if the message should be sent to the sink
+   */
+  bool accepts(Sink &sink, Logging::Level level, std::string_view key,
+               units::second_t now);
+
+  /**
+   * @brief Call back with each sink that accepts the message
+   *
+   * @tparam TCallback Callable taking an ILogger &
+   * @param level
+   * @param key
+   * @param callback
+   */
+  template <typename TCallback>
+  void dispatch(Logging::Level level, std::string_view key,
+                TCallback &&callback) {
+    if (!shouldLog(level) || m_sinks.empty())
+      return;
+
+    units::second_t now = currentTime();
+    for (auto &sink : m_sinks) {
+      bool accepted;
+      {
+        // Only the filter state is shared; sinks do their own locking
+        std::lock_guard lock{m_filterMutex};
+        accepted = accepts(sink, level, key, now);
+      }
+      if (accepted) {
+        callback(*sink.logger);
+      }
+    }
+  }
+
+  void logFormat(Logging::Level level, std::string_view key,
+                 const std::string format, va_list ap);
+
+  static units::second_t currentTime();
+
+  std::vector<Sink> m_sinks;
+  /**
+   * @brief Guards the per-key filter state of every sink
+   *
+   */
+  std::mutex m_filterMutex;
+};
+} // namespace subzero
+
+#define FanoutWriter subzero::FanoutLogger::getInstance()
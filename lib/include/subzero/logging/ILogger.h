@@ -7,6 +7,8 @@
 
 #include <cstdarg>
 #include <string>
+#include <string_view>
+#include <utility>
 
 #include "subzero/utils/UtilConstants.h"
 
@@ -60,6 +62,35 @@ public:
   virtual void logError(std::string key, wpi::Sendable *val) = 0;
   virtual void logFatal(std::string key, wpi::Sendable *val) = 0;
 
+  /**
+   * @brief Log an already formatted message
+   *
+   * @param level
+   * @param key
+   * @param message
+   */
+  virtual void logMessage(Logging::Level level, std::string_view key,
+                          std::string_view message) = 0;
+
+  /**
+   * @brief Log with an fmt format string, checked at compile time. Levels
+   * below Logging::kMinLogLevel compile to nothing; use the SUBZERO_LOG macros
+   * to also skip building the key
+   *
+   * @tparam level
+   * @tparam Args
+   * @param key
+   * @param format
+   * @param args
+   */
+  template <Logging::Level level, typename... Args>
+  void logFormatted(std::string_view key, fmt::format_string<Args...> format,
+                    Args &&...args) {
+    if constexpr (Logging::IsLevelEnabled(level)) {
+      logMessage(level, key, fmt::format(format, std::forward<Args>(args)...));
+    }
+  }
+
 protected:
   std::string levelToString(Logging::Level level) const {
     using namespace Logging;
@@ -95,7 +126,30 @@ protected:
   }
 
   inline bool shouldLog(Logging::Level level) {
-    return static_cast<int>(level) >= static_cast<int>(Logging::kMinLogLevel);
+    return Logging::IsLevelEnabled(level);
   }
 };
-} // namespace subzero
\ No newline at end of file
+} // namespace subzero
+
+/**
+ * @brief Log through an ILogger with an fmt format string. Below
+ * Logging::kMinLogLevel the whole statement is discarded, including the key and
+ * arguments, so it costs nothing
+ *
+ */
+#define SUBZERO_LOG(logger, level, key, ...)                                   \
+  do {                                                                         \
+    if constexpr (subzero::Logging::IsLevelEnabled(level)) {                   \
+      (logger).template logFormatted<level>(key, __VA_ARGS__);                 \
+    }                                                                          \
+  } while (0)
+#define SUBZERO_LOG_VERBOSE(logger, key, ...)                                  \
+  SUBZERO_LOG(logger, subzero::Logging::Level::VERBOSE, key, __VA_ARGS__)
+#define SUBZERO_LOG_INFO(logger, key, ...)                                     \
+  SUBZERO_LOG(logger, subzero::Logging::Level::INFO, key, __VA_ARGS__)
+#define SUBZERO_LOG_WARNING(logger, key, ...)                                  \
+  SUBZERO_LOG(logger, subzero::Logging::Level::WARNING, key, __VA_ARGS__)
+#define SUBZERO_LOG_ERROR(logger, key, ...)                                    \
+  SUBZERO_LOG(logger, subzero::Logging::Level::ERROR, key, __VA_ARGS__)
+#define SUBZERO_LOG_FATAL(logger, key, ...)                                    \
+  SUBZERO_LOG(logger, subzero::Logging::Level::FATAL, key, __VA_ARGS__)
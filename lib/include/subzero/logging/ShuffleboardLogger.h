@@ -1,19 +1,38 @@
 #pragma once
 
+#include <frc/geometry/Pose2d.h>
+#include <networktables/BooleanTopic.h>
+#include <networktables/DoubleTopic.h>
+#include <networktables/StringTopic.h>
+#include <networktables/StructTopic.h>
+#include <wpi/StringMap.h>
+
+#include <cstddef>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "subzero/logging/ILogger.h"
 
 namespace subzero {
 
 /**
- * @brief Outputs formatted information to SmartDashboard
+ * @brief Outputs formatted information to SmartDashboard. Each key gets typed
+ * NT publishers that are created on first use and reused, so repeated calls
+ * don't go through SmartDashboard's string lookups
  *
- * @remark Singleton class
+ * @remark Singleton class; safe to call from any thread
  */
-class ShuffleboardLogger : ILogger {
+class ShuffleboardLogger : public ILogger {
 public:
+  /**
+   * @brief Handle for a key, from InternKey()
+   *
+   */
+  using KeyId = size_t;
+
   static ShuffleboardLogger &getInstance() {
     static ShuffleboardLogger instance;
 
@@ -56,18 +75,85 @@ public:
   void logError(std::string key, wpi::Sendable *val) override;
   void logFatal(std::string key, wpi::Sendable *val) override;
 
+  void logMessage(Logging::Level level, std::string_view key,
+                  std::string_view message) override;
+
+  /**
+   * @brief Look a key up once so hot paths can publish by ID without hashing
+   * the key again
+   *
+   * @param key Key in SmartDashboard
+   * @return KeyId
+   */
+  KeyId InternKey(std::string_view key);
+
+  void PublishNumber(KeyId id, double val);
+  void PublishBoolean(KeyId id, bool val);
+  void PublishString(KeyId id, std::string_view val);
+  void PublishPose(KeyId id, const frc::Pose2d &val);
+
+  /**
+   * @brief Publish poses as Pose2d structs, which dashboards such as
+   * AdvantageScope read directly, instead of JSON text. Off by default to keep
+   * existing dashboard layouts working. A key already published as another
+   * type is unpublished and republished on its next pose
+   *
+   * @param enabled
+   */
+  inline void SetPosesAsStructs(bool enabled) {
+    std::lock_guard lock{m_mutex};
+    m_posesAsStructs = enabled;
+  }
+
 private:
+  /**
+   * @brief Publishers for one key; at most one is live, created the first time
+   * a value of its type is published
+   *
+   */
+  struct KeyPublishers {
+    std::string topic;
+    nt::DoublePublisher number;
+    nt::BooleanPublisher boolean;
+    nt::StringPublisher string;
+    nt::StructPublisher<frc::Pose2d> pose;
+  };
+
   ShuffleboardLogger();
 
-  std::string formatToShuffleboardString(Logging::Level level,
-                                         const std::string format, ...) {
-    va_list args;
-    va_start(args, format);
-    std::string val = formatString(format, args);
-    val = levelToString(level) + " - " + val;
-    va_end(args);
+  void logFormat(Logging::Level level, std::string_view key,
+                 const std::string format, va_list ap);
 
-    return val;
-  }
+  void publishMessage(KeyId id, Logging::Level level,
+                      std::string_view message);
+
+  /**
+   * @brief Unpublish every type of a key, before it's published as a new one
+   *
+   * @param publishers
+   */
+  static void releasePublishers(KeyPublishers &publishers);
+
+  /**
+   * @brief PublishString() for callers already holding m_mutex
+   *
+   * @param id
+   * @param val
+   */
+  void publishString(KeyId id, std::string_view val);
+
+  /**
+   * @brief Guards the key table, the publishers and the message buffer
+   *
+   */
+  std::mutex m_mutex;
+  wpi::StringMap<KeyId> m_keyIds;
+  std::vector<KeyPublishers> m_publishers;
+  bool m_posesAsStructs = false;
+  /**
+   * @brief Reused when prefixing messages with their level
+   *
+   */
+  std::string m_messageBuffer;
 };
 } // namespace subzero
\ No newline at end of file
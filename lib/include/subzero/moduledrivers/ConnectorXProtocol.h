@@ -0,0 +1,335 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Wire format shared with the ConnectorX board. Kept free of WPILib so
+ * it can be used by host-side tools and tests
+ *
+ */
+namespace ConnectorX {
+struct Message {
+  uint8_t data[61];
+  uint8_t len;
+  // Set to 0xFFFF to send to all
+  uint16_t teamNumber;
+};
+namespace Commands {
+struct LedConfiguration {
+  uint16_t count;
+  uint8_t brightness;
+};
+
+struct Configuration {
+  int8_t valid;
+  uint16_t teamNumber;
+  // Send messages to 2 other teams
+  uint16_t initialTeams[2];
+  LedConfiguration led0;
+  LedConfiguration led1;
+};
+enum class CommandType {
+  // W
+  On = 0,
+  // W
+  Off = 1,
+  // W
+  Pattern = 2,
+  // W
+  ChangeColor = 3,
+  // R
+  ReadPatternDone = 4,
+  // W
+  SetLedPort = 5,
+  // R
+  ReadAnalog = 6,
+  // W
+  DigitalSetup = 7,
+  // W
+  DigitalWrite = 8,
+  // R
+  DigitalRead = 9,
+  // W
+  SetConfig = 10,
+  // R
+  ReadConfig = 11,
+  // W
+  RadioSend = 12,
+  // R
+  RadioGetLatestReceived = 13,
+  // R
+  GetColor = 14,
+  // R
+  GetPort = 15,
+  // W
+  SetPatternZone = 16,
+  // W
+  SetNewZones = 17,
+  // W
+  SyncStates = 18,
+};
+
+struct CommandOn {};
+
+struct CommandOff {};
+
+// * Set delay to -1 to use default delay
+struct CommandPattern {
+  uint8_t pattern;
+  uint8_t oneShot;
+  int16_t delay;
+};
+
+struct CommandColor {
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+};
+
+struct CommandReadPatternDone {};
+
+struct CommandSetLedPort {
+  uint8_t port;
+};
+
+struct CommandReadAnalog {
+  uint8_t port;
+};
+
+struct CommandDigitalSetup {
+  uint8_t port;
+  /** Follows the Arduino-defined values for pinMode
+   * INPUT = 0
+   * INPUT_PULLUP = 2
+   * INPUT_PULLDOWN = 3
+   * OUTPUT = 1
+   * OUTPUT_2MA = 4
+   * OUTPUT_4MA = 5
+   * OUTPUT_8MA = 6
+   * OUTPUT_12MA = 7
+   */
+  uint8_t mode;
+};
+
+struct CommandDigitalWrite {
+  uint8_t port;
+  uint8_t value;
+};
+
+struct CommandDigitalRead {
+  uint8_t port;
+};
+
+struct CommandSetConfig {
+  Configuration config;
+};
+
+struct CommandReadConfig {};
+
+struct CommandRadioSend {
+  Message msg;
+};
+
+struct CommandRadioGetLatestReceived {};
+
+struct CommandGetColor {};
+
+struct CommandGetPort {};
+
+struct CommandSetPatternZone {
+  uint16_t zoneIndex;
+  // if non-zero, will go from end pixel to start pixel
+  uint8_t reversed;
+};
+
+struct NewZone {
+  uint16_t offset;
+  uint16_t count;
+};
+
+struct CommandSetNewZones {
+  uint8_t zoneCount;
+  NewZone zones[10];
+};
+
+struct CommandSyncZoneStates {
+  uint8_t zoneCount;
+  uint8_t zones[10];
+};
+
+union CommandData {
+  CommandOn commandOn;
+  CommandOff commandOff;
+  CommandPattern commandPattern;
+  CommandColor commandColor;
+  CommandReadPatternDone commandReadPatternDone;
+  CommandSetLedPort commandSetLedPort;
+  CommandReadAnalog commandReadAnalog;
+  CommandDigitalSetup commandDigitalSetup;
+  CommandDigitalWrite commandDigitalWrite;
+  CommandDigitalRead commandDigitalRead;
+  CommandSetConfig commandSetConfig;
+  CommandReadConfig commandReadConfig;
+  CommandRadioSend commandRadioSend;
+  CommandRadioGetLatestReceived commandRadioGetLatestReceived;
+  CommandGetColor commandGetColor;
+  CommandGetPort commandGetPort;
+  CommandSetPatternZone commandSetPatternZone;
+  CommandSetNewZones commandSetNewZones;
+  CommandSyncZoneStates commandSyncZoneStates;
+};
+
+struct Command {
+  CommandType commandType;
+  CommandData commandData;
+};
+
+struct ResponsePatternDone {
+  uint8_t done;
+};
+
+struct ResponseReadAnalog {
+  uint16_t value;
+};
+
+struct ResponseDigitalRead {
+  uint8_t value;
+};
+
+struct ResponseRadioLastReceived {
+  Message msg;
+};
+
+struct ResponseReadConfiguration {
+  Commands::Configuration config;
+};
+
+struct ResponseReadColor {
+  uint32_t color;
+};
+
+struct ResponseReadPort {
+  uint8_t port;
+};
+
+union ResponseData {
+  ResponsePatternDone responsePatternDone;
+  ResponseReadAnalog responseReadAnalog;
+  ResponseDigitalRead responseDigitalRead;
+  ResponseRadioLastReceived responseRadioLastReceived;
+  ResponseReadConfiguration responseReadConfiguration;
+  ResponseReadColor responseReadColor;
+  ResponseReadPort responseReadPort;
+};
+
+struct Response {
+  CommandType commandType;
+  ResponseData responseData;
+};
+
+/**
+ * @brief A command as laid out on the wire
+ *
+ */
+struct EncodedCommand {
+  uint8_t data[sizeof(CommandData) + 1];
+  /**
+   * @brief Bytes of data to send, including the command type
+   *
+   */
+  uint8_t length;
+  /**
+   * @brief Bytes to read back; 0 for write-only commands
+   *
+   */
+  uint8_t responseSize;
+};
+
+/**
+ * @brief Serialize a command the way the board expects it: the command type
+ * followed by only the used part of its data
+ *
+ * @param command
+ * @return EncodedCommand
+ */
+inline EncodedCommand Encode(const Command &command) {
+  EncodedCommand encoded{};
+  uint8_t sendLen = 0;
+  uint8_t recSize = 0;
+
+  switch (command.commandType) {
+  case CommandType::On:
+  case CommandType::Off:
+    sendLen = 0;
+    break;
+  case CommandType::ReadConfig:
+    sendLen = 0;
+    recSize = sizeof(ResponseReadConfiguration);
+    break;
+  case CommandType::ReadPatternDone:
+    sendLen = 0;
+    recSize = sizeof(ResponsePatternDone);
+    break;
+  case CommandType::RadioGetLatestReceived:
+    sendLen = 0;
+    recSize = sizeof(ResponseRadioLastReceived);
+    break;
+  case CommandType::SetLedPort:
+    sendLen = 1;
+    break;
+  case CommandType::ReadAnalog:
+    sendLen = 1;
+    recSize = sizeof(ResponseReadAnalog);
+    break;
+  case CommandType::DigitalRead:
+    sendLen = 1;
+    recSize = sizeof(ResponseDigitalRead);
+    break;
+  case CommandType::DigitalWrite:
+    sendLen = sizeof(CommandDigitalWrite);
+    break;
+  case CommandType::DigitalSetup:
+    sendLen = sizeof(CommandDigitalSetup);
+    break;
+  case CommandType::Pattern:
+    sendLen = sizeof(CommandPattern);
+    break;
+  case CommandType::ChangeColor:
+    sendLen = sizeof(CommandColor);
+    break;
+  case CommandType::SetConfig:
+    sendLen = sizeof(CommandSetConfig);
+    break;
+  case CommandType::RadioSend:
+    sendLen = sizeof(CommandRadioSend);
+    break;
+  case CommandType::GetColor:
+    sendLen = 0;
+    break;
+  case CommandType::GetPort:
+    sendLen = 0;
+    break;
+  case CommandType::SetPatternZone:
+    sendLen = 3;
+    break;
+  case CommandType::SetNewZones:
+    sendLen =
+        sizeof(CommandSetNewZones::zoneCount) +
+        command.commandData.commandSetNewZones.zoneCount * sizeof(NewZone);
+    break;
+  case CommandType::SyncStates:
+    sendLen =
+        sizeof(CommandSyncZoneStates::zoneCount) +
+        command.commandData.commandSyncZoneStates.zoneCount * sizeof(uint8_t);
+    break;
+  }
+
+  encoded.data[0] = static_cast<uint8_t>(command.commandType);
+  std::memcpy(encoded.data + 1, &command.commandData, sendLen);
+  encoded.length = sendLen + 1;
+  encoded.responseSize = recSize;
+  return encoded;
+}
+} // namespace Commands
+} // namespace ConnectorX
@@ -2,8 +2,11 @@
 
 #include <units/angle.h>
 #include <units/angular_velocity.h>
+#include <units/current.h>
+#include <units/temperature.h>
 #include <units/voltage.h>
 
+#include <optional>
 #include <string>
 
 namespace subzero {
@@ -25,9 +28,21 @@ public:
   virtual void RunWithVelocity(units::revolutions_per_minute_t rpm) = 0;
   virtual void RunWithVelocity(double percentage) = 0;
   virtual void RunToPosition(double position) = 0;
+  /**
+   * @brief Follow a moving position target. Unlike RunToPosition(), the PID
+   * state is kept between calls and the motor isn't stopped at the setpoint
+   *
+   * @param position
+   * @param feedforward Added to the PID output
+   */
+  virtual void TrackPosition(double position, units::volt_t feedforward) = 0;
   virtual void ResetEncoder(void) = 0;
+  virtual void SetEncoderPosition(double position) = 0;
   virtual double GetEncoderPosition(void) = 0;
   virtual std::optional<double> GetAbsoluteEncoderPosition(void) = 0;
+  virtual double GetEncoderVelocity(void) = 0;
+  virtual units::ampere_t GetOutputCurrent(void) = 0;
+  virtual units::celsius_t GetMotorTemperature(void) = 0;
   virtual void SetEncoderConversionFactor(double factor) = 0;
   virtual void SetAbsoluteEncoderConversionFactor(double factor) = 0;
   virtual void Stop(void) = 0;
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <units/current.h>
+#include <units/temperature.h>
+#include <units/time.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "subzero/motor/IPidMotorController.h"
+
+namespace subzero {
+
+/**
+ * @brief The readings of a single controller taken from the latest snapshot
+ *
+ */
+struct MotorSensorSample {
+  double position;
+  std::optional<double> absolutePosition;
+  /**
+   * @brief Converted distance units per second
+   *
+   */
+  double velocity;
+  units::ampere_t current;
+  units::celsius_t temperature;
+  /**
+   * @brief FPGA time at which the snapshot was taken
+   *
+   */
+  units::second_t timestamp;
+};
+
+/**
+ * @brief Reads the sensors of every registered controller exactly once per
+ * loop so that all consumers see the same time slice without issuing their own
+ * CAN reads
+ *
+ * @remark Singleton class
+ */
+class MotorSensorRegistry {
+public:
+  using Handle = size_t;
+
+  /**
+   * @brief Snapshots older than this aren't returned; one 20 ms loop plus
+   * scheduling jitter
+   *
+   */
+  static constexpr units::second_t kMaxSnapshotAge = 30_ms;
+
+  static MotorSensorRegistry &getInstance() {
+    static MotorSensorRegistry instance;
+
+    return instance;
+  }
+
+  /**
+   * @brief Add a controller to the snapshot; it will be read starting with the
+   * next call to Refresh()
+   *
+   * @param controller
+   * @return Handle Used to look up the controller's readings
+   */
+  Handle Register(IPidMotorController *controller);
+
+  /**
+   * @brief Stop reading the controller. The handle may be given to the next
+   * controller registered
+   *
+   * @param handle
+   */
+  void Unregister(Handle handle);
+
+  /**
+   * @brief ! Call this once at the top of RobotPeriodic, before
+   * CommandScheduler::Run() !
+   *
+   */
+  void Refresh();
+
+  /**
+   * @brief Re-read a single controller; use after an encoder reset so the
+   * remainder of the loop doesn't see the stale position
+   *
+   * @param handle
+   */
+  void Refresh(Handle handle);
+
+  /**
+   * @brief Get the latest readings of a controller
+   *
+   * @param handle
+   * @return std::optional<MotorSensorSample> Empty if Refresh() has not run
+   * since the controller was registered, or not within kMaxSnapshotAge
+   */
+  std::optional<MotorSensorSample> GetSample(Handle handle);
+
+  /**
+   * @brief Check if at least one snapshot has been taken
+   *
+   * @return true
+   * @return false
+   */
+  bool HasSnapshot();
+
+private:
+  MotorSensorRegistry() = default;
+
+  void ReadController(size_t index);
+
+  std::mutex m_mutex;
+  std::vector<IPidMotorController *> m_controllers;
+  // Struct-of-arrays snapshot; each index matches m_controllers
+  std::vector<double> m_positions;
+  std::vector<double> m_absolutePositions;
+  std::vector<uint8_t> m_hasAbsolutePosition;
+  std::vector<double> m_velocities;
+  std::vector<double> m_currents;
+  std::vector<double> m_temperatures;
+  // Whether each controller has been read since it was registered
+  std::vector<uint8_t> m_sampled;
+  std::vector<Handle> m_freeHandles;
+  bool m_hasSnapshot = false;
+  units::second_t m_timestamp = 0_s;
+  // Whether the current stale snapshot has been logged
+  bool m_staleLogged = false;
+};
+} // namespace subzero
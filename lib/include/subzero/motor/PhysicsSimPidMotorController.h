@@ -0,0 +1,231 @@
+#pragma once
+
+#include <frc/Timer.h>
+#include <frc/controller/PIDController.h>
+#include <frc/system/plant/DCMotor.h>
+#include <units/angular_velocity.h>
+#include <units/current.h>
+#include <units/math.h>
+#include <units/moment_of_inertia.h>
+#include <units/time.h>
+#include <units/torque.h>
+#include <units/voltage.h>
+
+#include <cstdint>
+#include <functional>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <string>
+
+#include "subzero/motor/IPidMotorController.h"
+
+namespace subzero {
+
+/**
+ * @brief A simulated controller backed by a DC motor model, load inertia,
+ * gravity, and friction. The mechanism is integrated with a fixed sub-step
+ * over the time that actually elapsed between calls to Update(), so results
+ * only depend on the time source and the seed; this allows running
+ * simulations faster than real time
+ *
+ */
+class PhysicsSimPidMotorController : public IPidMotorController {
+public:
+  struct PhysicsSimConfig {
+    /**
+     * @brief Motor(s) driving the mechanism, e.g. frc::DCMotor::NEO(2)
+     *
+     */
+    frc::DCMotor motor;
+    /**
+     * @brief Motor rotations per mechanism rotation; greater than 1 is a
+     * reduction
+     *
+     */
+    double gearing;
+    /**
+     * @brief Moment of inertia of the load at the mechanism's output
+     *
+     */
+    units::kilogram_square_meter_t loadMoi;
+    /**
+     * @brief Friction torque at the output that must be overcome to start
+     * moving
+     *
+     */
+    units::newton_meter_t staticFriction = 0_Nm;
+    /**
+     * @brief Friction torque at the output in N*m per rad/s of output speed
+     *
+     */
+    double viscousFriction = 0;
+    /**
+     * @brief Optional. Returns the gravity torque at the output for a
+     * mechanism position in converted encoder units; positive values pull the
+     * mechanism towards decreasing positions
+     *
+     */
+    std::optional<std::function<units::newton_meter_t(double)>> gravityTorque;
+    /**
+     * @brief Battery voltage; commanded voltages are clamped to +/- this value
+     *
+     */
+    units::volt_t supplyVoltage = 12_V;
+    /**
+     * @brief Fixed integration step
+     *
+     */
+    units::second_t subStep = 1_ms;
+    /**
+     * @brief Standard deviation of the noise added to encoder positions, in
+     * converted units
+     *
+     */
+    double positionNoiseStdDev = 0;
+    /**
+     * @brief Seed for the encoder noise
+     *
+     */
+    uint32_t seed = 0;
+  };
+
+  /**
+   * @brief Construct a new PhysicsSimPidMotorController
+   *
+   * @param name Display name
+   * @param pidSettings Initial PID settings
+   * @param config Physical model
+   * @param timeSource Returns the current time; defaults to the FPGA clock.
+   * Pass a simulated clock to run faster than real time
+   */
+  explicit PhysicsSimPidMotorController(
+      std::string name, PidSettings pidSettings, PhysicsSimConfig config,
+      std::function<units::second_t()> timeSource =
+          [] { return frc::Timer::GetFPGATimestamp(); });
+
+  inline void Set(double percentage) override {
+    Set(m_config.supplyVoltage * percentage);
+  }
+
+  void Set(units::volt_t volts) override;
+
+  inline void SetPidTolerance(double tolerance) override {
+    m_pidController.SetTolerance(tolerance);
+  }
+
+  /**
+   * @brief ! Call this every loop in Periodic ! Runs the position loop and
+   * advances the model by the time elapsed since the previous call
+   *
+   */
+  void Update() override;
+
+  void RunWithVelocity(units::revolutions_per_minute_t rpm) override;
+
+  void RunWithVelocity(double percentage) override;
+
+  void RunToPosition(double position) override;
+
+  void TrackPosition(double position, units::volt_t feedforward) override;
+
+  inline void ResetEncoder() override {
+    m_encoderOffset = GetMotorRotations();
+  }
+
+  inline void SetEncoderPosition(double position) override {
+    m_encoderOffset = GetMotorRotations() - position / m_conversionFactor;
+  }
+
+  double GetEncoderPosition() override;
+
+  inline std::optional<double> GetAbsoluteEncoderPosition() override {
+    return std::nullopt;
+  }
+
+  double GetEncoderVelocity() override;
+
+  inline units::ampere_t GetOutputCurrent() override {
+    return units::math::abs(m_current);
+  }
+
+  inline units::celsius_t GetMotorTemperature() override { return 25_degC; }
+
+  inline void SetEncoderConversionFactor(double factor) override {
+    m_conversionFactor = factor;
+  }
+
+  inline void SetAbsoluteEncoderConversionFactor(double factor) override {}
+
+  void Stop() override;
+
+  inline const PidSettings &GetPidSettings() override { return m_settings; }
+
+  void UpdatePidSettings(PidSettings settings) override;
+
+  /**
+   * @brief Advance the model without consulting the time source
+   *
+   * @param duration
+   */
+  void Simulate(units::second_t duration);
+
+  /**
+   * @brief Teleport the mechanism to a position in converted units and bring
+   * it to rest; the encoder will read this position
+   *
+   * @param position
+   */
+  void SetMechanismPosition(double position);
+
+  /**
+   * @brief Get the true mechanism position in converted units, without noise
+   * or encoder offset
+   *
+   * @return double
+   */
+  inline double GetMechanismPosition() {
+    return GetMotorRotations() * m_conversionFactor;
+  }
+
+  /**
+   * @brief Get the last commanded voltage
+   *
+   * @return units::volt_t
+   */
+  inline units::volt_t GetAppliedVoltage() const { return m_appliedVoltage; }
+
+private:
+  enum class ControlMode { kStopped, kVoltage, kVelocity, kPosition };
+
+  void Advance(units::second_t elapsed);
+
+  void Step(units::second_t dt);
+
+  units::volt_t ClampVoltage(units::volt_t volts) const;
+
+  inline double GetMotorRotations() const {
+    return m_outputAngle.value() * m_config.gearing / (2 * std::numbers::pi);
+  }
+
+  PidSettings m_settings;
+  PhysicsSimConfig m_config;
+  std::function<units::second_t()> m_timeSource;
+  frc::PIDController m_pidController;
+  std::mt19937 m_rng;
+  std::normal_distribution<double> m_noise;
+  ControlMode m_mode = ControlMode::kStopped;
+  units::volt_t m_appliedVoltage = 0_V;
+  units::radians_per_second_t m_velocityTarget = 0_rad_per_s;
+  double m_positionTarget = 0;
+  bool m_tracking = false;
+  units::volt_t m_feedforward = 0_V;
+  units::radian_t m_outputAngle = 0_rad;
+  units::radians_per_second_t m_outputVelocity = 0_rad_per_s;
+  units::ampere_t m_current = 0_A;
+  double m_encoderOffset = 0;
+  double m_conversionFactor = 1.0;
+  std::optional<units::second_t> m_lastTime;
+  units::second_t m_accumulatedTime = 0_s;
+};
+} // namespace subzero
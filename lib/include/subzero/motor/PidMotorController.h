@@ -93,6 +93,31 @@ public:
    */
   void RunWithVelocity(double percentage) override;
 
+  /**
+   * @brief Set to this velocity with an additional voltage applied on top of
+   * the motor controller's closed loop output
+   *
+   * @param rpm
+   * @param arbFeedforward
+   */
+  void RunWithVelocity(units::revolutions_per_minute_t rpm,
+                       units::volt_t arbFeedforward);
+
+  /**
+   * @brief Have this motor mirror the leader's output in hardware so that a
+   * single command drives both
+   *
+   * @param leader
+   * @param inverted Spin opposite to the leader
+   */
+  void Follow(PidMotorController &leader, bool inverted);
+
+  /**
+   * @brief Go back to accepting commands independently of the leader
+   *
+   */
+  void StopFollowing();
+
   /**
    * @brief Enables absolute positioning and sets the target to the position
    *
@@ -100,17 +125,48 @@ public:
    */
   void RunToPosition(double position) override;
 
+  void TrackPosition(double position, units::volt_t feedforward) override;
+
   inline virtual void ResetEncoder() override {
     m_encoder.SetPosition(0);
     ConsoleWriter.logInfo(m_name + " PID Controller", "Reset encoder%s", "");
   }
 
+  /**
+   * @brief Set the relative encoder to the given converted position
+   *
+   * @param position
+   */
+  inline void SetEncoderPosition(double position) override {
+    m_encoder.SetPosition(position);
+  }
+
   inline double GetEncoderPosition() override {
     return m_encoder.GetPosition();
   }
 
   std::optional<double> GetAbsoluteEncoderPosition() override;
 
+  /**
+   * @brief Get the relative encoder's velocity in converted distance units per
+   * second
+   *
+   * @return double
+   */
+  inline double GetEncoderVelocity() override {
+    // The velocity conversion factor matches the position one, so the native
+    // reading is per minute
+    return m_encoder.GetVelocity() / 60.0;
+  }
+
+  inline units::ampere_t GetOutputCurrent() override {
+    return units::ampere_t(m_motor.GetOutputCurrent());
+  }
+
+  inline units::celsius_t GetMotorTemperature() override {
+    return units::celsius_t(m_motor.GetMotorTemperature());
+  }
+
   /**
    * @brief Sets the multiplier for going between encoder ticks and actual
    * distance
@@ -163,6 +219,8 @@ protected:
   frc::PIDController m_pidController;
   bool m_absolutePositionEnabled = false;
   double m_absoluteTarget = 0;
+  bool m_tracking = false;
+  units::volt_t m_feedforward = 0_V;
   const units::revolutions_per_minute_t m_maxRpm;
   bool m_isInitialized;
 };
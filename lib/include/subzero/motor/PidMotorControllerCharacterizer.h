@@ -0,0 +1,205 @@
+#pragma once
+
+#include <frc/Timer.h>
+#include <frc2/command/CommandPtr.h>
+#include <frc2/command/Subsystem.h>
+#include <units/time.h>
+#include <units/voltage.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "subzero/motor/IPidMotorController.h"
+
+namespace subzero {
+
+/**
+ * @brief Drives a controller through quasistatic and dynamic voltage tests,
+ * fits a feedforward model to the recorded data, and recommends PID settings
+ * from it
+ *
+ */
+class PidMotorControllerCharacterizer {
+public:
+  enum class MechanismType {
+    /**
+     * @brief kS + kV + kA, e.g. flywheels and turrets
+     *
+     */
+    kSimple,
+    /**
+     * @brief Adds a constant kG
+     *
+     */
+    kElevator,
+    /**
+     * @brief Adds kG scaled by the cosine of the arm angle
+     *
+     */
+    kArm
+  };
+
+  enum class Direction { kForward, kReverse };
+
+  using RampRate = decltype(1_V / 1_s);
+
+  struct CharacterizationConfig {
+    MechanismType mechanismType;
+    /**
+     * @brief Voltage increase per second during quasistatic tests
+     *
+     */
+    RampRate quasistaticRampRate = RampRate(1);
+    /**
+     * @brief Constant voltage applied during dynamic tests
+     *
+     */
+    units::volt_t dynamicStepVoltage = 7_V;
+    /**
+     * @brief Maximum length of a single test
+     *
+     */
+    units::second_t testTimeout = 10_s;
+    /**
+     * @brief Number of samples that will be recorded; the buffer is allocated
+     * once up front
+     *
+     */
+    size_t bufferCapacity = 4096;
+    /**
+     * @brief Arms only. Multiplies encoder positions to get radians
+     *
+     */
+    double armPositionToRadians = 1.0;
+    /**
+     * @brief Arms only. Encoder position at which the arm is horizontal
+     *
+     */
+    double armHorizontalPosition = 0.0;
+    /**
+     * @brief Largest acceptable position error, in encoder units; used to
+     * weigh the recommended gains
+     *
+     */
+    double maxPositionError = 1.0;
+    /**
+     * @brief Largest acceptable velocity error, in encoder units per second
+     *
+     */
+    double maxVelocityError = 1.0;
+    /**
+     * @brief Largest voltage the recommended gains should command
+     *
+     */
+    units::volt_t maxControlEffort = 12_V;
+    /**
+     * @brief Optional. Ends a test early when it returns true, e.g. at a soft
+     * limit
+     *
+     */
+    std::optional<std::function<bool(Direction)>> isAtLimit;
+  };
+
+  struct CharacterizationResult {
+    /**
+     * @brief True if enough samples were available for the fit
+     *
+     */
+    bool valid;
+    double kS;
+    double kV;
+    double kA;
+    double kG;
+    /**
+     * @brief Coefficient of determination of the fit
+     *
+     */
+    double rSquared;
+    size_t sampleCount;
+    /**
+     * @brief P and D for RunToPosition(), in volts per encoder unit
+     *
+     */
+    PidSettings positionSettings;
+    /**
+     * @brief P and FF for the motor controller's velocity loop, in its native
+     * units
+     *
+     */
+    PidSettings velocitySettings;
+  };
+
+  /**
+   * @brief Construct a new PidMotorControllerCharacterizer
+   *
+   * @param controller Controller under test
+   * @param subsystem Subsystem that owns the controller; required by the tests
+   * @param config
+   */
+  PidMotorControllerCharacterizer(IPidMotorController &controller,
+                                  frc2::Subsystem &subsystem,
+                                  CharacterizationConfig config);
+
+  /**
+   * @brief Slowly ramp the voltage
+   *
+   * @param direction
+   * @return frc2::CommandPtr
+   */
+  frc2::CommandPtr Quasistatic(Direction direction);
+
+  /**
+   * @brief Apply a voltage step
+   *
+   * @param direction
+   * @return frc2::CommandPtr
+   */
+  frc2::CommandPtr Dynamic(Direction direction);
+
+  /**
+   * @brief Run all four tests, then fit and publish the result to
+   * SmartDashboard
+   *
+   * @return frc2::CommandPtr
+   */
+  frc2::CommandPtr FullRoutine();
+
+  /**
+   * @brief Fit the feedforward model to the recorded samples
+   *
+   * @return CharacterizationResult
+   */
+  CharacterizationResult Analyze();
+
+  /**
+   * @brief Discard all recorded samples
+   *
+   */
+  void ClearSamples();
+
+private:
+  struct Sample {
+    double voltage;
+    double position;
+    double velocity;
+    double timestamp;
+    uint16_t test;
+  };
+
+  frc2::CommandPtr RunTest(bool quasistatic, Direction direction);
+
+  void RecommendGains(CharacterizationResult &result);
+
+  void Publish(const CharacterizationResult &result);
+
+  IPidMotorController &m_controller;
+  frc2::Subsystem &m_subsystem;
+  CharacterizationConfig m_config;
+  std::vector<Sample> m_samples;
+  frc::Timer m_timer;
+  uint16_t m_testIndex = 0;
+};
+} // namespace subzero
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <frc/controller/PIDController.h>
 #include <frc/smartdashboard/SmartDashboard.h>
 #include <rev/SparkBase.h>
 #include <units/angle.h>
 #include <units/angular_velocity.h>
+#include <units/voltage.h>
 
+#include <optional>
 #include <string>
 
 #include "subzero/logging/ConsoleLogger.h"
@@ -12,6 +15,57 @@
 
 namespace subzero {
 
+/**
+ * @brief How the two motors of a PidMotorControllerPair are commanded
+ *
+ */
+enum class PidMotorControllerPairMode {
+  /**
+   * @brief Each motor gets its own setpoint and closes its own loop
+   *
+   */
+  kIndependent,
+  /**
+   * @brief The second motor follows the first in hardware, so a single
+   * command drives both. Ratios other than 1 are not supported by the
+   * hardware; the second motor is then commanded from the first's setpoint
+   *
+   */
+  kLeaderFollower,
+  /**
+   * @brief Both motors run their own velocity loop and an additional loop on
+   * the difference between them corrects the second motor
+   *
+   */
+  kDifferential
+};
+
+/**
+ * @brief Configuration for synchronizing the motors of a pair
+ *
+ */
+struct PidMotorControllerPairConfig {
+  PidMotorControllerPairMode mode = PidMotorControllerPairMode::kIndependent;
+  /**
+   * @brief The second motor spins opposite to the first
+   *
+   */
+  bool secondInverted = false;
+  /**
+   * @brief Second motor speed per unit of first motor speed
+   *
+   */
+  double ratio = 1.0;
+  /**
+   * @brief Gains of the loop on the speed difference, in volts per converted
+   * unit per second; only used in differential mode
+   *
+   */
+  double differentialP = 0.0;
+  double differentialI = 0.0;
+  double differentialD = 0.0;
+};
+
 /**
  * @brief Encapsulates a pair of motors that should be treated as a single unit
  *
@@ -19,35 +73,71 @@ namespace subzero {
  * @tparam TController
  * @tparam TRelativeEncoder
  * @tparam TAbsoluteEncoder
+ * @tparam TPidConfig
  */
 template <typename TMotor, typename TController, typename TRelativeEncoder,
-          typename TAbsoluteEncoder>
+          typename TAbsoluteEncoder, typename TPidConfig>
 class PidMotorControllerPair {
 public:
+  using Controller = PidMotorController<TMotor, TController, TRelativeEncoder,
+                                        TAbsoluteEncoder, TPidConfig>;
+
   /**
-   * @brief Construct a new Pi MotorControllerPair
+   * @brief Construct a new PidMotorControllerPair
    *
    * @param prefix Common identifier prefix in SmartDashboard
-   * @param first
+   * @param first Leader in the synchronized modes
    * @param second
+   * @param config
    */
-  explicit PidMotorControllerPair(
-      std::string prefix,
-      PidMotorController<TMotor, TController, TRelativeEncoder,
-                         TAbsoluteEncoder> &first,
-      PidMotorController<TMotor, TController, TRelativeEncoder,
-                         TAbsoluteEncoder> &second)
+  explicit PidMotorControllerPair(std::string prefix, Controller &first,
+                                  Controller &second,
+                                  PidMotorControllerPairConfig config = {})
       : m_shuffleboardPrefix{prefix}, m_controllerFirst{first},
-        m_controllerSecond{second} {}
+        m_controllerSecond{second}, m_config{config},
+        m_differentialController{config.differentialP, config.differentialI,
+                                 config.differentialD} {
+    if (IsHardwareFollower()) {
+      m_controllerSecond.Follow(m_controllerFirst, m_config.secondInverted);
+    } else if (m_config.mode == PidMotorControllerPairMode::kLeaderFollower) {
+      ConsoleWriter.logWarning(
+          m_shuffleboardPrefix,
+          "Ratio %.3f can't be followed in hardware; commanding both motors",
+          m_config.ratio);
+    }
+  }
+
+  /**
+   * @brief Run both motors from a single setpoint; the second motor's speed is
+   * derived from the ratio and inversion
+   *
+   * @param rpm RPM of the first motor
+   */
+  void RunWithVelocity(units::revolutions_per_minute_t rpm) {
+    m_velocityTarget = rpm;
+    m_controllerFirst.RunWithVelocity(rpm);
+
+    if (IsHardwareFollower()) {
+      return;
+    }
+
+    m_differentialController.Reset();
+    m_controllerSecond.RunWithVelocity(GetSecondTarget(rpm));
+  }
 
   /**
    * @brief Run motors at the given RPM
    *
    * @param rpmFirst RPM of the first motor
-   * @param rpmSecond RPM of the second motor
+   * @param rpmSecond RPM of the second motor; ignored unless independent
    */
   void RunWithVelocity(units::revolutions_per_minute_t rpmFirst,
                        units::revolutions_per_minute_t rpmSecond) {
+    if (m_config.mode != PidMotorControllerPairMode::kIndependent) {
+      RunWithVelocity(rpmFirst);
+      return;
+    }
+
     m_controllerFirst.RunWithVelocity(rpmFirst);
     m_controllerSecond.RunWithVelocity(rpmSecond);
   }
@@ -56,20 +146,66 @@ public:
    * @brief Run motors at the given percentage of max RPM
    *
    * @param percentageFirst Percentage of the first motor
-   * @param percentageSecond Percentage of the second motor
+   * @param percentageSecond Percentage of the second motor; ignored unless
+   * independent
    */
   void RunWithVelocity(double percentageFirst, double percentageSecond) {
+    if (m_config.mode != PidMotorControllerPairMode::kIndependent) {
+      m_velocityTarget = std::nullopt;
+      m_controllerFirst.RunWithVelocity(percentageFirst);
+
+      if (!IsHardwareFollower()) {
+        m_controllerSecond.RunWithVelocity(
+            percentageFirst * m_config.ratio *
+            (m_config.secondInverted ? -1.0 : 1.0));
+      }
+      return;
+    }
+
     m_controllerFirst.RunWithVelocity(percentageFirst);
     m_controllerSecond.RunWithVelocity(percentageSecond);
   }
 
+  /**
+   * @brief ! Call this every loop in Periodic ! Updates the sync error and
+   * runs the differential loop
+   *
+   */
+  void Update() {
+    m_syncError = m_controllerFirst.GetEncoderVelocity() * m_config.ratio *
+                      (m_config.secondInverted ? -1.0 : 1.0) -
+                  m_controllerSecond.GetEncoderVelocity();
+    frc::SmartDashboard::PutNumber(m_shuffleboardPrefix + " Sync Error",
+                                   m_syncError);
+
+    if (m_config.mode == PidMotorControllerPairMode::kDifferential &&
+        m_velocityTarget) {
+      units::volt_t correction =
+          units::volt_t(m_differentialController.Calculate(-m_syncError, 0));
+      m_controllerSecond.RunWithVelocity(
+          GetSecondTarget(m_velocityTarget.value()), correction);
+    }
+  }
+
+  /**
+   * @brief Get the difference between the expected and actual speed of the
+   * second motor, in converted units per second
+   *
+   * @return double
+   */
+  inline double GetSyncError() const { return m_syncError; }
+
   /**
    * @brief Stop both motors
    *
    */
   void Stop() {
+    m_velocityTarget = std::nullopt;
     m_controllerFirst.Stop();
-    m_controllerSecond.Stop();
+
+    if (!IsHardwareFollower()) {
+      m_controllerSecond.Stop();
+    }
   }
 
   const PidSettings &GetPidSettings() const { return m_pidSettings; }
@@ -84,10 +220,22 @@ public:
   const std::string m_shuffleboardPrefix;
 
 private:
-  PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder>
-      &m_controllerFirst;
-  PidMotorController<TMotor, TController, TRelativeEncoder, TAbsoluteEncoder>
-      &m_controllerSecond;
+  inline bool IsHardwareFollower() const {
+    return m_config.mode == PidMotorControllerPairMode::kLeaderFollower &&
+           m_config.ratio == 1.0;
+  }
+
+  inline units::revolutions_per_minute_t
+  GetSecondTarget(units::revolutions_per_minute_t rpm) const {
+    return rpm * m_config.ratio * (m_config.secondInverted ? -1.0 : 1.0);
+  }
+
+  Controller &m_controllerFirst;
+  Controller &m_controllerSecond;
+  PidMotorControllerPairConfig m_config;
+  frc::PIDController m_differentialController;
+  std::optional<units::revolutions_per_minute_t> m_velocityTarget;
+  double m_syncError = 0.0;
   PidSettings m_pidSettings;
 };
 
@@ -98,14 +246,15 @@ private:
  * @tparam TController
  * @tparam TRelativeEncoder
  * @tparam TAbsoluteEncoder
+ * @tparam TPidConfig
  */
 template <typename TMotor, typename TController, typename TRelativeEncoder,
-          typename TAbsoluteEncoder>
+          typename TAbsoluteEncoder, typename TPidConfig>
 class PidMotorControllerPairTuner {
 public:
   explicit PidMotorControllerPairTuner(
       PidMotorControllerPair<TMotor, TController, TRelativeEncoder,
-                             TAbsoluteEncoder> &controllerPair)
+                             TAbsoluteEncoder, TPidConfig> &controllerPair)
       : m_controllerPair{controllerPair} {
     frc::SmartDashboard::PutNumber(m_controllerPair.m_shuffleboardPrefix +
                                        " P Gain",
@@ -148,6 +297,6 @@ public:
 
 private:
   PidMotorControllerPair<TMotor, TController, TRelativeEncoder,
-                         TAbsoluteEncoder> &m_controllerPair;
+                         TAbsoluteEncoder, TPidConfig> &m_controllerPair;
 };
 } // namespace subzero
\ No newline at end of file
@@ -35,8 +35,14 @@ public:
 
   void RunToPosition(double position) override;
 
+  void TrackPosition(double position, units::volt_t feedforward) override;
+
   inline void ResetEncoder() override { m_currentRelativePosition = 0; }
 
+  inline void SetEncoderPosition(double position) override {
+    m_currentRelativePosition = position / m_conversionFactor;
+  }
+
   inline double GetEncoderPosition() override {
     return m_currentRelativePosition * m_conversionFactor;
   }
@@ -45,6 +51,14 @@ public:
     return std::nullopt;
   }
 
+  inline double GetEncoderVelocity() override {
+    return (m_currentRpm / (1_min / 1_s)).value() * m_conversionFactor;
+  }
+
+  inline units::ampere_t GetOutputCurrent() override { return 0_A; }
+
+  inline units::celsius_t GetMotorTemperature() override { return 25_degC; }
+
   inline void SetEncoderConversionFactor(double factor) override {
     m_conversionFactor = factor;
   }
@@ -66,6 +80,8 @@ private:
   bool m_absolutePositionEnabled = false;
   double m_conversionFactor = 1.0;
   double m_absoluteTarget = 0;
+  bool m_tracking = false;
+  units::volt_t m_feedforward = 0_V;
   const units::revolutions_per_minute_t m_maxRpm;
   units::revolutions_per_minute_t m_currentRpm = 0_rpm;
 };
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <networktables/DoubleArrayTopic.h>
+#include <units/time.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include "subzero/profiling/TraceRecorder.h"
+
+namespace subzero {
+
+/**
+ * @brief Timing statistics for one instrumented section of code. Recording is
+ * lock-free so zones can be hit from any thread
+ *
+ */
+class ProfileZone {
+public:
+  /**
+   * @brief Histogram buckets; 4 per power of 2, which puts p99 within 25%
+   *
+   */
+  static constexpr size_t kBuckets = 160;
+
+  struct Stats {
+    uint64_t count;
+    double minMs;
+    double meanMs;
+    double p99Ms;
+    double maxMs;
+  };
+
+  /**
+   * @brief Add one timing to the current window
+   *
+   * @param nanoseconds
+   */
+  void Record(uint64_t nanoseconds);
+
+  /**
+   * @brief Summarize the current window and start a new one
+   *
+   * @return Stats
+   */
+  Stats TakeStats();
+
+  /**
+   * @brief Name the zone was registered under; owned by the LoopProfiler and
+   * valid for its lifetime
+   *
+   */
+  const char *name = nullptr;
+
+private:
+  static size_t BucketFor(uint64_t nanoseconds);
+  static uint64_t BucketUpperBound(size_t bucket);
+
+  std::atomic<uint64_t> m_count = 0;
+  std::atomic<uint64_t> m_total = 0;
+  std::atomic<uint64_t> m_min = UINT64_MAX;
+  std::atomic<uint64_t> m_max = 0;
+  std::array<std::atomic<uint32_t>, kBuckets> m_histogram{};
+};
+
+/**
+ * @brief Aggregates the zones marked with SUBZERO_PROFILE_ZONE and publishes
+ * min, mean, p99 and max per zone to NetworkTables once per second. Use it to
+ * find what's behind loop overruns
+ *
+ * @remark Singleton class; call Periodic() from the robot's periodic loop
+ */
+class LoopProfiler {
+public:
+  /**
+   * @brief Fixed size of the zone table; zones beyond this aren't timed.
+   * Released zones free their slot
+   *
+   */
+  static constexpr size_t kMaxZones = 64;
+
+  static LoopProfiler &getInstance() {
+    static LoopProfiler instance;
+
+    return instance;
+  }
+
+  LoopProfiler(const LoopProfiler &) = delete;
+  LoopProfiler &operator=(const LoopProfiler &) = delete;
+
+  /**
+   * @brief Find or add a zone. Called once per call site through a static
+   * local, or once per object for zones named at runtime, so the cost only
+   * shows up on the first hit
+   *
+   * @param name Copied; calls with the same name share a zone
+   * @return nullptr if the table is full
+   */
+  ProfileZone *RegisterZone(std::string_view name);
+
+  /**
+   * @brief Drop one registration of a zone; once every registration of it is
+   * released, its slot and NT topic are freed. Objects that register zones
+   * per instance call this when destroyed
+   *
+   * @param zone From RegisterZone(); may be nullptr
+   */
+  void ReleaseZone(ProfileZone *zone);
+
+  /**
+   * @brief Turn timing on or off at runtime; while off, a zone costs one
+   * relaxed load
+   *
+   * @param enabled
+   */
+  inline void SetEnabled(bool enabled) {
+    m_enabled.store(enabled, std::memory_order_relaxed);
+  }
+
+  inline bool IsEnabled() const {
+    return m_enabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Publishes to /Profiler/<zone> as [count, min, mean, p99, max] in
+   * milliseconds once the publish period has elapsed
+   *
+   */
+  void Periodic();
+
+private:
+  LoopProfiler() = default;
+
+  std::array<ProfileZone, kMaxZones> m_zones;
+  std::array<nt::DoubleArrayPublisher, kMaxZones> m_publishers;
+  /**
+   * @brief Registrations per slot; 0 marks a free slot
+   *
+   */
+  std::array<uint32_t, kMaxZones> m_refCounts{};
+  /**
+   * @brief Zone names are never erased, so trace events recorded before a
+   * zone was released still point at valid strings
+   *
+   */
+  std::set<std::string, std::less<>> m_names;
+  size_t m_zoneCount = 0;
+  /**
+   * @brief Guards registration, release and publishing
+   *
+   */
+  std::mutex m_registerMutex;
+  bool m_loggedFull = false;
+  std::atomic<bool> m_enabled = true;
+  std::optional<units::second_t> m_lastPublishTime;
+};
+
+/**
+ * @brief Times its own lifetime into a zone, and into the trace while the
+ * TraceRecorder is recording
+ *
+ */
+class ScopedZone {
+public:
+  explicit ScopedZone(ProfileZone *zone)
+      : m_zone{zone},
+        m_profiling{zone && LoopProfiler::getInstance().IsEnabled()},
+        m_tracing{zone && TraceRecorder::getInstance().IsRecording()} {
+    if (m_profiling || m_tracing) {
+      m_start = std::chrono::steady_clock::now();
+    }
+  }
+
+  ~ScopedZone() {
+    if (!m_profiling && !m_tracing) {
+      return;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    if (m_profiling) {
+      m_zone->Record(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start)
+              .count());
+    }
+    if (m_tracing) {
+      TraceRecorder::getInstance().Record(m_zone->name, m_start, end);
+    }
+  }
+
+  ScopedZone(const ScopedZone &) = delete;
+  ScopedZone &operator=(const ScopedZone &) = delete;
+
+private:
+  ProfileZone *m_zone;
+  bool m_profiling;
+  bool m_tracing;
+  std::chrono::steady_clock::time_point m_start;
+};
+} // namespace subzero
+
+#define SUBZERO_PROFILE_CONCAT_INNER(a, b) a##b
+#define SUBZERO_PROFILE_CONCAT(a, b) SUBZERO_PROFILE_CONCAT_INNER(a, b)
+
+/**
+ * @brief Time the rest of the enclosing scope under a static name. Define
+ * SUBZERO_DISABLE_PROFILING to compile every zone out
+ *
+ */
+#ifdef SUBZERO_DISABLE_PROFILING
+#define SUBZERO_PROFILE_ZONE(name)
+#else
+#define SUBZERO_PROFILE_ZONE(name)                                             \
+  static subzero::ProfileZone *SUBZERO_PROFILE_CONCAT(profileZone, __LINE__) = \
+      subzero::LoopProfiler::getInstance().RegisterZone(name);                 \
+  subzero::ScopedZone SUBZERO_PROFILE_CONCAT(scopedZone, __LINE__) {           \
+    SUBZERO_PROFILE_CONCAT(profileZone, __LINE__)                              \
+  }
+#endif
+
+/**
+ * @brief Time the rest of the enclosing scope into a zone registered at
+ * runtime, e.g. one per subsystem instance. Compiled out along with
+ * SUBZERO_PROFILE_ZONE
+ *
+ */
+#ifdef SUBZERO_DISABLE_PROFILING
+#define SUBZERO_PROFILE_SCOPE(zone)
+#else
+#define SUBZERO_PROFILE_SCOPE(zone)                                            \
+  subzero::ScopedZone SUBZERO_PROFILE_CONCAT(scopedZone, __LINE__) { zone }
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <frc2/command/CommandHelper.h>
+#include <frc2/command/CommandPtr.h>
+#include <frc2/command/WrapperCommand.h>
+
+#include <memory>
+
+#include "subzero/profiling/LoopProfiler.h"
+
+namespace subzero {
+
+/**
+ * @brief Times a command's Execute() into a zone named Command/<name>, so
+ * commands show up in the LoopProfiler and traces next to the subsystems they
+ * drive
+ *
+ */
+class ProfiledCommand
+    : public frc2::CommandHelper<frc2::WrapperCommand, ProfiledCommand> {
+public:
+  explicit ProfiledCommand(std::unique_ptr<frc2::Command> &&command);
+
+  ProfiledCommand(ProfiledCommand &&other);
+
+  ~ProfiledCommand() override;
+
+  void Initialize() override;
+  void Execute() override;
+
+  /**
+   * @brief Wrap a command for profiling; e.g.
+   * `Profiled(arm.MoveToPositionAbsolute(90_deg))`
+   *
+   * @param command
+   * @return frc2::CommandPtr
+   */
+  static frc2::CommandPtr Profiled(frc2::CommandPtr &&command);
+
+private:
+  /**
+   * @brief Registered on first Initialize(), after any WithName()
+   *
+   */
+  ProfileZone *m_zone = nullptr;
+};
+} // namespace subzero
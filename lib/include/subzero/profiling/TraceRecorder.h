@@ -0,0 +1,156 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace subzero {
+
+/**
+ * @brief Records profiler zones as timed events and writes them to a Chrome
+ * Trace Event JSON file, which chrome://tracing, Perfetto UI and Speedscope
+ * can open. Each thread writes into its own lock-free buffer, so recording
+ * never blocks the loop; a background thread moves the events to disk
+ *
+ * @remark Singleton class
+ */
+class TraceRecorder {
+public:
+  /**
+   * @brief Events each thread can buffer between writer passes; more are
+   * dropped and counted
+   *
+   */
+  static constexpr size_t kThreadBufferSize = 4096;
+
+  static TraceRecorder &getInstance() {
+    static TraceRecorder instance;
+
+    return instance;
+  }
+
+  TraceRecorder(const TraceRecorder &) = delete;
+  TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+  /**
+   * @brief Start writing a new trace file
+   *
+   * @param directory Where to put the file; empty uses the USB stick on the
+   * roboRIO (/u) or the working directory in simulation
+   * @return false if already recording or the file couldn't be opened
+   */
+  bool Start(std::string directory = "");
+
+  /**
+   * @brief Write the remaining events and close the file
+   *
+   */
+  void Stop();
+
+  inline bool IsRecording() const {
+    return m_recording.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Add a complete event for the calling thread
+   *
+   * @param name Must be a string literal or otherwise outlive the recording
+   * @param start
+   * @param end
+   */
+  void Record(const char *name, std::chrono::steady_clock::time_point start,
+              std::chrono::steady_clock::time_point end);
+
+  /**
+   * @brief Name the calling thread in the trace. Threads that don't call this
+   * are named after the OS thread name, captured when they first record
+   *
+   * @param name
+   */
+  void SetThreadName(std::string name);
+
+  /**
+   * @brief Get the number of events dropped because a thread's buffer was full
+   *
+   * @return uint64_t
+   */
+  inline uint64_t GetDroppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct Event {
+    const char *name;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+  };
+
+  /**
+   * @brief Single-producer, single-consumer ring owned by one thread
+   *
+   */
+  struct ThreadBuffer {
+    int threadId;
+    /**
+     * @brief Guarded by m_buffersMutex, as is namePending
+     *
+     */
+    std::string name;
+    /**
+     * @brief Set when the name hasn't been written to the current trace yet
+     *
+     */
+    bool namePending = true;
+    std::array<Event, kThreadBufferSize> events;
+    alignas(64) std::atomic<size_t> head = 0;
+    alignas(64) std::atomic<size_t> tail = 0;
+  };
+
+  TraceRecorder() = default;
+
+  ~TraceRecorder();
+
+  /**
+   * @brief Get the calling thread's buffer, creating it on first use
+   *
+   * @return ThreadBuffer&
+   */
+  ThreadBuffer &GetThreadBuffer();
+
+  void Run();
+
+  /**
+   * @brief Write every buffered event to the file. Only holds m_buffersMutex
+   * while taking a snapshot of the buffers
+   *
+   */
+  void Drain();
+
+  std::atomic<bool> m_recording = false;
+  std::atomic<uint64_t> m_dropped = 0;
+  std::chrono::steady_clock::time_point m_startTime;
+  /**
+   * @brief Buffers live as long as the recorder so threads can keep a raw
+   * pointer to theirs
+   *
+   */
+  std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+  std::mutex m_buffersMutex;
+  /**
+   * @brief Snapshot of m_buffers and their heads, reused by each Drain()
+   *
+   */
+  std::vector<std::pair<ThreadBuffer *, size_t>> m_drainBuffers;
+  std::ofstream m_file;
+  std::thread m_writer;
+};
+} // namespace subzero
@@ -1,14 +1,20 @@
 #pragma once
 
+#include <frc/AsynchronousInterrupt.h>
 #include <frc/DigitalInput.h>
 #include <frc/DutyCycleEncoder.h>
+#include <frc/Timer.h>
 #include <frc/controller/PIDController.h>
+#include <frc/filter/Debouncer.h>
 #include <frc/smartdashboard/MechanismLigament2d.h>
 #include <frc/smartdashboard/MechanismRoot2d.h>
 #include <frc2/command/CommandPtr.h>
 #include <frc2/command/FunctionalCommand.h>
 #include <frc2/command/InstantCommand.h>
 #include <frc2/command/TrapezoidProfileSubsystem.h>
+#include <networktables/BooleanTopic.h>
+#include <networktables/DoubleTopic.h>
+#include <networktables/StringTopic.h>
 #include <rev/SparkClosedLoopController.h>
 #include <rev/SparkFlex.h>
 #include <rev/SparkMax.h>
@@ -17,15 +23,23 @@
 #include <units/angular_acceleration.h>
 #include <units/angular_velocity.h>
 #include <units/length.h>
+#include <units/math.h>
 #include <units/velocity.h>
 
+#include <atomic>
+#include <cmath>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "subzero/frc/smartdashboard/RateLimitedPublisher.h"
 #include "subzero/frc2/command/EmptyCommand.h"
 #include "subzero/logging/ConsoleLogger.h"
+#include "subzero/logging/FanoutLogger.h"
 #include "subzero/logging/ShuffleboardLogger.h"
+#include "subzero/motor/MotorSensorRegistry.h"
 #include "subzero/motor/PidMotorController.h"
+#include "subzero/profiling/LoopProfiler.h"
 #include "subzero/singleaxis/ISingleAxisSubsystem.h"
 
 namespace subzero {
@@ -53,6 +67,7 @@ public:
   using Acceleration =
       units::compound_unit<Velocity, units::inverse<units::seconds>>;
   using Acceleration_t = units::unit_t<Acceleration>;
+  using Waypoint = typename ISingleAxisSubsystem<TDistance>::Waypoint;
 
 protected:
   bool IsMovementAllowed(double speed, bool ignoreEncoder = false);
@@ -65,6 +80,8 @@ public:
       ISingleAxisSubsystem<TDistance>::SingleAxisConfig config,
       frc::MechanismObject2d *mechanismNode = nullptr);
 
+  ~BaseSingleAxisSubsystem();
+
   /**
    * @brief Runs the absolute positioning task and updates relevant info on
    * SmartDashboard
@@ -75,9 +92,13 @@ public:
   virtual void RunMotorVelocity(Velocity_t speed,
                                 bool ignoreEncoder = false) = 0;
 
-  inline void UseState(PidState setpoint) override {
-    m_controller.RunToPosition(setpoint.position.value());
-  }
+  /**
+   * @brief Tracks the profile setpoint without resetting the PID each step,
+   * adding feedforward when a model is configured
+   *
+   * @param setpoint
+   */
+  void UseState(PidState setpoint) override;
 
   inline void RunMotorSpeedDefault(bool ignoreEncoder = false) override {
     RunMotorVelocity(m_config.defaultSpeed, ignoreEncoder);
@@ -86,8 +107,36 @@ public:
   void RunMotorPercentage(double percentSpeed,
                           bool ignoreEncoder = false) override;
 
+  /**
+   * @brief Reads from the MotorSensorRegistry snapshot when one is available
+   *
+   * @return Distance_t
+   */
   inline Distance_t GetCurrentPosition() override {
-    return Distance_t(m_controller.GetEncoderPosition());
+    auto sample = MotorSensorRegistry::getInstance().GetSample(m_sensorHandle);
+
+    return Distance_t(sample ? sample.value().position
+                             : m_controller.GetEncoderPosition());
+  }
+
+  /**
+   * @brief The last setpoint from the profile; TrapezoidProfileSubsystem
+   * starts the next goal from there rather than from the encoder
+   *
+   * @return Waypoint
+   */
+  inline Waypoint GetProfileState() override { return m_profileState; }
+
+  /**
+   * @brief Reads from the MotorSensorRegistry snapshot when one is available
+   *
+   * @return std::optional<double>
+   */
+  inline std::optional<double> GetAbsolutePosition() {
+    auto sample = MotorSensorRegistry::getInstance().GetSample(m_sensorHandle);
+
+    return sample ? sample.value().absolutePosition
+                  : m_controller.GetAbsoluteEncoderPosition();
   }
 
   void Stop() override;
@@ -102,16 +151,45 @@ public:
     return AtLimitSwitchMax() || GetCurrentPosition() >= m_config.maxDistance;
   }
 
+  /**
+   * @brief Also true while an interrupt has latched the switch and the axis
+   * hasn't started moving away from it
+   *
+   * @return bool
+   */
   bool AtLimitSwitchMin() override;
 
+  /**
+   * @brief Also true while an interrupt has latched the switch and the axis
+   * hasn't started moving away from it
+   *
+   * @return bool
+   */
   bool AtLimitSwitchMax() override;
 
+  /**
+   * @brief Get the FPGA time at which the min limit switch interrupt last
+   * fired; empty if interrupts are disabled or it isn't latched
+   *
+   * @return std::optional<units::second_t>
+   */
+  std::optional<units::second_t> GetMinLimitLatchTime();
+
   frc2::CommandPtr MoveToPositionAbsolute(Distance_t position) override;
 
   inline frc2::CommandPtr MoveToPositionRelative(Distance_t position) override {
     return MoveToPositionAbsolute(m_goalPosition + position);
   }
 
+  frc2::CommandPtr
+  MoveThroughWaypoints(std::vector<Waypoint> waypoints) override;
+
+  /**
+   * @brief Drive to the min limit switch and zero there, or stall against the
+   * hard stop if there's no switch and stallHoming is configured
+   *
+   * @return frc2::CommandPtr
+   */
   frc2::CommandPtr Home() override;
 
   inline frc2::CommandPtr ResetRelativeEncoder() {
@@ -136,14 +214,110 @@ protected:
   std::optional<frc::DigitalInput *> m_minLimitSwitch;
   std::optional<frc::DigitalInput *> m_maxLimitSwitch;
   TController &m_controller;
+  MotorSensorRegistry::Handle m_sensorHandle;
   ISingleAxisSubsystem<TDistance>::SingleAxisConfig m_config;
   std::string m_name;
+  /**
+   * @brief Named after the subsystem so each instance is timed on its own;
+   * released when the subsystem is destroyed
+   *
+   */
+  ProfileZone *m_periodicZone =
+      LoopProfiler::getInstance().RegisterZone(m_name + "::Periodic");
   Distance_t m_goalPosition;
   bool m_pidEnabled;
   bool m_home;
   bool resetOccurred = false;
+  bool m_absoluteSeeded = false;
+  frc::Debouncer m_stallDebouncer{0_s};
+  frc::Timer m_homingTimer;
+  bool m_stalled = false;
   double m_latestSpeed;
+  std::optional<Velocity_t> m_lastSetpointVelocity;
+  /**
+   * @brief Starts where TrapezoidProfileSubsystem does by default
+   *
+   */
+  PidState m_profileState{Distance_t(0), Velocity_t(0)};
+  std::vector<Waypoint> m_waypoints;
+  size_t m_waypointIndex = 0;
   frc2::CommandPtr m_resetEncCmd = EmptyCommand().ToPtr();
   frc::MechanismLigament2d *m_ligament2d;
+
+  /**
+   * @brief Runs on the interrupt thread when a limit switch is pressed. Only
+   * latches the edge; HandleLimitSwitchEdges() acts on it
+   *
+   * @param isMin
+   * @param edgeTime FPGA time of the falling edge
+   */
+  void OnLimitSwitchInterrupt(bool isMin, units::second_t edgeTime);
+
+  /**
+   * @brief Act on edges latched by the interrupt since the last call: stop
+   * and drop the profile goal if moving into the switch, and zero the encoder
+   * at a min edge while homing. Runs on the main thread
+   *
+   */
+  void HandleLimitSwitchEdges();
+
+  /**
+   * @brief Check that the waypoints can be followed without exceeding the
+   * limits or constraints, logging the first problem found
+   *
+   * @param waypoints
+   * @param start Measured position the sequence starts from; the first
+   * segment's direction is only checked when it's known
+   * @return bool
+   */
+  bool ValidateWaypoints(const std::vector<Waypoint> &waypoints,
+                         std::optional<Distance_t> start = std::nullopt);
+
+  /**
+   * @brief Convert an absolute encoder reading to an axis position, unwrapping
+   * it around the range of motion
+   *
+   * @param absolutePosition
+   * @return Distance_t
+   */
+  Distance_t GetSeededPosition(double absolutePosition);
+
+  frc2::CommandPtr StallHome();
+
+  std::atomic<bool> m_minLimitLatched = false;
+  std::atomic<bool> m_maxLimitLatched = false;
+  std::atomic<double> m_minLimitLatchTime = 0;
+  /**
+   * @brief Set by the interrupt, cleared once HandleLimitSwitchEdges() has
+   * acted on the edge
+   *
+   */
+  std::atomic<bool> m_minLimitEdgePending = false;
+  std::atomic<bool> m_maxLimitEdgePending = false;
+  bool m_homing = false;
+  bool m_zeroedAtEdge = false;
+
+  // Created once so Periodic doesn't build keys or send unchanged values
+  RateLimitedPublisher<nt::BooleanTopic> m_pidEnabledPublisher{m_name +
+                                                               " Pid Enabled"};
+  RateLimitedPublisher<nt::DoubleTopic> m_positionPublisher{m_name +
+                                                            " Position"};
+  RateLimitedPublisher<nt::DoubleTopic> m_absolutePositionPublisher{
+      m_name + " Absolute Position"};
+  RateLimitedPublisher<nt::StringTopic> m_convertedPositionPublisher{
+      m_name + " Converted Position", 100_ms};
+  RateLimitedPublisher<nt::BooleanTopic> m_minLimitSwitchPublisher{
+      m_name + " Min Limit Switch"};
+  RateLimitedPublisher<nt::BooleanTopic> m_maxLimitSwitchPublisher{
+      m_name + " Max Limit Switch"};
+  RateLimitedPublisher<nt::BooleanTopic> m_atMinPublisher{m_name + " At Min"};
+  RateLimitedPublisher<nt::BooleanTopic> m_atMaxPublisher{m_name + " At Max"};
+  RateLimitedPublisher<nt::BooleanTopic> m_movementAllowedPublisher{
+      m_name + " Movement Allowed"};
+  RateLimitedPublisher<nt::DoubleTopic> m_speedPublisher{m_name + " Speed %"};
+
+  // Declared last so they're destroyed before anything their callbacks use
+  std::unique_ptr<frc::AsynchronousInterrupt> m_minLimitInterrupt;
+  std::unique_ptr<frc::AsynchronousInterrupt> m_maxLimitInterrupt;
 };
 } // namespace subzero
\ No newline at end of file
@@ -7,12 +7,16 @@
 #include <frc2/command/SubsystemBase.h>
 #include <units/angle.h>
 #include <units/angular_velocity.h>
+#include <units/current.h>
 #include <units/length.h>
 #include <units/velocity.h>
+#include <units/voltage.h>
 
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace subzero {
 
@@ -27,6 +31,110 @@ struct SingleAxisMechanism {
   frc::Color8Bit color;
 };
 
+/**
+ * @brief Feedforward model used while following a motion profile. Gains are in
+ * volts per converted distance unit, per second, and per second squared
+ *
+ */
+struct SingleAxisFeedforward {
+  enum class Type {
+    /**
+     * @brief kS + kV + kA, e.g. turrets
+     *
+     */
+    kSimple,
+    /**
+     * @brief Adds a constant kG
+     *
+     */
+    kElevator,
+    /**
+     * @brief Adds kG scaled by the cosine of the arm angle
+     *
+     */
+    kArm
+  };
+
+  Type type;
+  double kS;
+  double kG;
+  double kV;
+  double kA;
+  /**
+   * @brief Arms only. Multiplies positions to get radians, e.g. pi / 180 for
+   * degrees
+   *
+   */
+  double armPositionToRadians = 1.0;
+  /**
+   * @brief Arms only. Position at which the arm is horizontal
+   *
+   */
+  double armHorizontalPosition = 0.0;
+
+  /**
+   * @brief Get the voltage needed to hold the given state
+   *
+   * @param position
+   * @param velocity
+   * @param acceleration
+   * @return units::volt_t
+   */
+  inline units::volt_t Calculate(double position, double velocity,
+                                 double acceleration) const {
+    double volts = kS * ((velocity > 0) - (velocity < 0)) + kV * velocity +
+                   kA * acceleration;
+
+    if (type == Type::kElevator) {
+      volts += kG;
+    } else if (type == Type::kArm) {
+      volts += kG * std::cos((position - armHorizontalPosition) *
+                             armPositionToRadians);
+    }
+
+    return units::volt_t(volts);
+  }
+};
+
+/**
+ * @brief Homing against the hard stop for axes without a min limit switch
+ *
+ */
+struct StallHomingConfig {
+  /**
+   * @brief Voltage that drives the axis toward its min; keep it low enough
+   * that stalling against the hard stop is harmless
+   *
+   */
+  units::volt_t voltage = -2_V;
+  /**
+   * @brief Stalled once the current is at least this...
+   *
+   */
+  units::ampere_t currentThreshold = 20_A;
+  /**
+   * @brief ...and the speed is at most this, in converted units per second
+   *
+   */
+  double velocityThreshold = 0.01;
+  /**
+   * @brief How long both conditions must hold
+   *
+   */
+  units::second_t debounceTime = 0.1_s;
+  /**
+   * @brief Ignore stall samples for this long after homing starts, while the
+   * motor's inrush current looks like a stall
+   *
+   */
+  units::second_t blankingTime = 0.25_s;
+  /**
+   * @brief Give up without zeroing after this long
+   *
+   */
+  units::second_t timeout = 3_s;
+};
+
 /**
  * @brief Single axis interface
  *
@@ -42,6 +150,30 @@ public:
   using Acceleration =
       units::compound_unit<Velocity, units::inverse<units::seconds>>;
   using Acceleration_t = units::unit_t<Acceleration>;
+  /**
+   * @brief A position to pass through and the velocity to pass through it at
+   *
+   */
+  using Waypoint = typename frc::TrapezoidProfile<Distance>::State;
+
+  /**
+   * @brief Seeds the relative encoder from the absolute encoder so the axis
+   * doesn't need to be homed
+   *
+   */
+  struct AbsoluteEncoderSeeding {
+    /**
+     * @brief Absolute encoder reading when the axis is at 0
+     *
+     */
+    Distance_t offset;
+    /**
+     * @brief Re-seed whenever the relative encoder is off by more than this;
+     * should be larger than the absolute encoder's lag at full speed
+     *
+     */
+    Distance_t driftThreshold;
+  };
 
   /**
    * @brief The configuration for single-axis mechanisms
@@ -125,6 +257,32 @@ public:
      *
      */
     frc::TrapezoidProfile<Distance>::Constraints profileConstraints;
+    /**
+     * @brief Optional. Adds feedforward to the position loop while following
+     * the motion profile
+     *
+     */
+    std::optional<SingleAxisFeedforward> feedforward;
+    /**
+     * @brief If true, the limit switches trigger interrupts that stop the
+     * motor as soon as they're hit instead of waiting for the next poll. The
+     * min switch also zeroes the encoder at the time of the edge
+     *
+     */
+    bool useLimitSwitchInterrupts;
+    /**
+     * @brief Optional. Requires absoluteEncoderDistancePerRevolution. Sets the
+     * relative encoder from the absolute one on startup and whenever they
+     * drift apart, instead of only zeroing near 0
+     *
+     */
+    std::optional<AbsoluteEncoderSeeding> absoluteEncoderSeeding;
+    /**
+     * @brief Optional. Lets Home() find the min by stalling against the hard
+     * stop when there's no min limit switch
+     *
+     */
+    std::optional<StallHomingConfig> stallHoming;
 
     SingleAxisConfig(
         Distance_t _minDistance, Distance_t _maxDistance,
@@ -137,7 +295,12 @@ public:
         std::optional<std::function<std::string(Distance_t)>>
             _conversionFunction,
         std::function<bool()> _ignoreLimit,
-        frc::TrapezoidProfile<Distance>::Constraints _profileConstraints)
+        frc::TrapezoidProfile<Distance>::Constraints _profileConstraints,
+        std::optional<SingleAxisFeedforward> _feedforward = std::nullopt,
+        bool _useLimitSwitchInterrupts = false,
+        std::optional<AbsoluteEncoderSeeding> _absoluteEncoderSeeding =
+            std::nullopt,
+        std::optional<StallHomingConfig> _stallHoming = std::nullopt)
         : minDistance{_minDistance}, maxDistance{_maxDistance},
           encoderDistancePerRevolution{_encoderDistancePerRevolution},
           absoluteEncoderDistancePerRevolution{
@@ -147,7 +310,10 @@ public:
           maxLimitSwitch{_maxLimitSwitch}, reversed{_reversed},
           mechanismConfig{_mechanismConfig},
           conversionFunction{_conversionFunction}, ignoreLimit{_ignoreLimit},
-          profileConstraints{_profileConstraints} {}
+          profileConstraints{_profileConstraints}, feedforward{_feedforward},
+          useLimitSwitchInterrupts{_useLimitSwitchInterrupts},
+          absoluteEncoderSeeding{_absoluteEncoderSeeding},
+          stallHoming{_stallHoming} {}
   };
 
   /**
@@ -188,6 +354,14 @@ public:
    */
   virtual Distance_t GetCurrentPosition() = 0;
 
+  /**
+   * @brief Get the state the motion profile continues from on the next move,
+   * which can still be moving and differ from the measured position
+   *
+   * @return Waypoint
+   */
+  virtual Waypoint GetProfileState() = 0;
+
   /**
    * @brief Check if axis is at the mimimum extent of motion
    *
@@ -237,6 +411,17 @@ public:
    */
   virtual frc2::CommandPtr MoveToPositionRelative(Distance_t position) = 0;
 
+  /**
+   * @brief Move through each waypoint in order without stopping in between.
+   * The whole sequence is checked against the limits and profile constraints
+   * before anything moves
+   *
+   * @param waypoints The last one must have a velocity of 0
+   * @return frc2::CommandPtr
+   */
+  virtual frc2::CommandPtr
+  MoveThroughWaypoints(std::vector<Waypoint> waypoints) = 0;
+
   /**
    * @brief Start the homing sequence
    *
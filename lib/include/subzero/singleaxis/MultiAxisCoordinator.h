@@ -0,0 +1,234 @@
+#pragma once
+
+#include <frc/trajectory/TrapezoidProfile.h>
+#include <frc2/command/CommandPtr.h>
+#include <frc2/command/Subsystem.h>
+#include <units/length.h>
+#include <units/time.h>
+
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "subzero/singleaxis/ISingleAxisSubsystem.h"
+
+namespace subzero {
+
+/**
+ * @brief Moves several single-axis subsystems at the same time while keeping
+ * their combined position out of forbidden regions, e.g. an arm swinging
+ * through the elevator's carriage. Each axis runs its own trapezoid profile;
+ * the coordinator only picks when each one starts, searching for the
+ * shortest total time that stays collision-free
+ *
+ */
+class MultiAxisCoordinator {
+public:
+  static constexpr units::second_t kDefaultCheckResolution = 10_ms;
+
+  /**
+   * @brief Position and velocity of one axis, in its distance unit
+   *
+   */
+  struct AxisState {
+    double position;
+    double velocity;
+  };
+
+  /**
+   * @brief A type-erased axis; positions are in the subsystem's distance unit
+   *
+   */
+  struct CoordinatedAxis {
+    std::string name;
+    /**
+     * @brief Must match the subsystem's profile constraints for the plan to
+     * match what actually runs
+     *
+     */
+    double maxVelocity;
+    double maxAcceleration;
+    /**
+     * @brief State the axis' profile continues from, which may still be moving
+     *
+     */
+    std::function<AxisState()> getState;
+    std::function<frc2::CommandPtr(double)> moveTo;
+    /**
+     * @brief Subsystem to require while coordinating; may be null
+     *
+     */
+    frc2::Subsystem *requirement;
+
+    /**
+     * @brief Wrap a single-axis subsystem
+     *
+     * @tparam TDistance
+     * @param name
+     * @param subsystem
+     * @param constraints The subsystem's profile constraints
+     * @return CoordinatedAxis
+     */
+    template <typename TDistance>
+    static CoordinatedAxis
+    FromSubsystem(std::string name, ISingleAxisSubsystem<TDistance> &subsystem,
+                  typename frc::TrapezoidProfile<TDistance>::Constraints
+                      constraints) {
+      using Distance_t = units::unit_t<TDistance>;
+
+      return CoordinatedAxis{
+          .name = name,
+          .maxVelocity = constraints.maxVelocity.value(),
+          .maxAcceleration = constraints.maxAcceleration.value(),
+          .getState =
+              [&subsystem] {
+                auto state = subsystem.GetProfileState();
+                return AxisState{state.position.value(),
+                                 state.velocity.value()};
+              },
+          .moveTo = [&subsystem](double position) {
+            return subsystem.MoveToPositionAbsolute(Distance_t(position));
+          },
+          .requirement = dynamic_cast<frc2::Subsystem *>(&subsystem)};
+    }
+  };
+
+  /**
+   * @brief An axis-aligned box in joint space that must never be entered.
+   * Axes without bounds are unconstrained
+   *
+   */
+  struct ForbiddenRegion {
+    std::string name;
+    /**
+     * @brief Inclusive min and max per axis, in the same order as the axes
+     *
+     */
+    std::vector<std::pair<double, double>> bounds;
+
+    /**
+     * @brief Bounds that never exclude anything on an axis
+     *
+     */
+    static constexpr std::pair<double, double> kAnyPosition = {
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::infinity()};
+  };
+
+  struct AxisPlan {
+    double start;
+    /**
+     * @brief A moving axis can't be held back, so it always starts at once
+     *
+     */
+    double startVelocity;
+    double goal;
+    units::second_t startDelay;
+    units::second_t duration;
+  };
+
+  struct MotionPlan {
+    /**
+     * @brief False if no collision-free ordering was found
+     *
+     */
+    bool valid;
+    units::second_t totalTime;
+    std::vector<AxisPlan> axes;
+  };
+
+  /**
+   * @brief Construct a new MultiAxisCoordinator
+   *
+   * @param axes
+   * @param forbiddenRegions
+   * @param checkResolution Time step used when checking a plan for
+   * collisions; must be positive, otherwise the default is used
+   */
+  MultiAxisCoordinator(
+      std::vector<CoordinatedAxis> axes,
+      std::vector<ForbiddenRegion> forbiddenRegions,
+      units::second_t checkResolution = kDefaultCheckResolution);
+
+  /**
+   * @brief Plan a move without running anything; useful offline to compare
+   * timings
+   *
+   * @param start Start position of each axis
+   * @param goal Goal position of each axis
+   * @return MotionPlan
+   */
+  MotionPlan Plan(const std::vector<double> &start,
+                  const std::vector<double> &goal) const;
+
+  /**
+   * @brief Plan a move from states that may still be moving, e.g. where each
+   * axis' profile currently is
+   *
+   * @param start Start state of each axis
+   * @param goal Goal position of each axis
+   * @return MotionPlan
+   */
+  MotionPlan Plan(const std::vector<AxisState> &start,
+                  const std::vector<double> &goal) const;
+
+  /**
+   * @brief Plan from the axes' profile states and run the moves concurrently
+   *
+   * @param goal Goal position of each axis
+   * @return frc2::CommandPtr
+   */
+  frc2::CommandPtr MoveTo(std::vector<double> goal);
+
+  /**
+   * @brief Log the plan through the ConsoleLogger
+   *
+   * @param plan
+   */
+  void Report(const MotionPlan &plan) const;
+
+private:
+  /**
+   * @brief The same profile the subsystem runs. Positions are in the axis'
+   * own unit; meters only stand in for it
+   *
+   */
+  using Profile = frc::TrapezoidProfile<units::meter>;
+
+  static Profile MakeProfile(const CoordinatedAxis &axis);
+
+  /**
+   * @brief Position along the axis' trapezoid profile
+   *
+   * @param axis
+   * @param plan
+   * @param time Time since the coordinated move started
+   * @return double
+   */
+  static double PositionAt(const CoordinatedAxis &axis, const AxisPlan &plan,
+                           units::second_t time);
+
+  static units::second_t ProfileDuration(const CoordinatedAxis &axis,
+                                         const AxisPlan &plan);
+
+  bool IsForbidden(const std::vector<double> &positions) const;
+
+  /**
+   * @brief Sample the plan over time, holding axes that aren't moving at their
+   * start
+   *
+   * @param axes
+   * @param moving
+   * @return bool
+   */
+  bool IsCollisionFree(const std::vector<AxisPlan> &axes,
+                       const std::vector<bool> &moving) const;
+
+  std::vector<CoordinatedAxis> m_axes;
+  std::vector<ForbiddenRegion> m_forbiddenRegions;
+  units::second_t m_checkResolution;
+};
+} // namespace subzero
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <units/time.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "subzero/motor/PhysicsSimPidMotorController.h"
+#include "subzero/singleaxis/BaseSingleAxisSubsystem.h"
+
+namespace subzero {
+
+namespace SingleAxisSimulation {
+/**
+ * @brief Guards creating and destroying subsystems and their commands, since
+ * the command scheduler they register with is not thread-safe
+ *
+ */
+inline std::mutex registrationMutex;
+} // namespace SingleAxisSimulation
+
+/**
+ * @brief Runs a single-axis subsystem against a PhysicsSimPidMotorController
+ * on a simulated clock, as fast as the CPU allows. Parameter grids can be
+ * swept across all cores to compare profile constraints, PID gains, and
+ * tolerances without waiting on the simulator GUI
+ *
+ * @tparam TDistance Distance unit of the subsystem
+ * @remark The HAL must be initialized, as it is in desktop simulation and unit
+ * tests
+ */
+template <typename TDistance> class SingleAxisSimulationHarness {
+public:
+  using Distance_t = units::unit_t<TDistance>;
+  using SingleAxisConfig =
+      typename ISingleAxisSubsystem<TDistance>::SingleAxisConfig;
+  using Subsystem =
+      BaseSingleAxisSubsystem<PhysicsSimPidMotorController, TDistance>;
+  using SubsystemFactory = std::function<std::unique_ptr<Subsystem>(
+      std::string, PhysicsSimPidMotorController &, SingleAxisConfig)>;
+
+  /**
+   * @brief A single configuration to simulate. The mechanism always starts at
+   * rest at 0, matching where the subsystem's profile starts
+   *
+   */
+  struct SimulationCase {
+    std::string name;
+    SingleAxisConfig config;
+    PidSettings pidSettings;
+    PhysicsSimPidMotorController::PhysicsSimConfig physicsConfig;
+    Distance_t goal;
+    /**
+     * @brief Give up if the goal hasn't been reached by this time
+     *
+     */
+    units::second_t timeout = 5_s;
+    /**
+     * @brief The goal is considered reached once the mechanism stays within
+     * tolerance for this long
+     *
+     */
+    units::second_t settleTime = 0.5_s;
+  };
+
+  struct SimulationResult {
+    std::string name;
+    /**
+     * @brief Time at which the mechanism entered the tolerance band for good;
+     * empty if it never settled
+     *
+     */
+    std::optional<units::second_t> timeToGoal;
+    /**
+     * @brief Furthest travel past the goal in the direction of motion
+     *
+     */
+    Distance_t overshoot;
+    Distance_t finalError;
+    /**
+     * @brief Number of loops spent outside of the min/max distance
+     *
+     */
+    int limitViolations;
+  };
+
+  /**
+   * @brief Construct a new SingleAxisSimulationHarness
+   *
+   * @param factory Creates the subsystem under test; see LinearFactory() and
+   * RotationalFactory()
+   */
+  explicit SingleAxisSimulationHarness(SubsystemFactory factory)
+      : m_factory{factory} {}
+
+  /**
+   * @brief Simulate a single case on the calling thread
+   *
+   * @param simCase
+   * @return SimulationResult
+   */
+  SimulationResult Run(const SimulationCase &simCase);
+
+  /**
+   * @brief Simulate every case, spread across threads
+   *
+   * @param cases
+   * @param threadCount Defaults to the number of cores
+   * @return std::vector<SimulationResult> In the same order as the cases
+   */
+  std::vector<SimulationResult>
+  RunAll(const std::vector<SimulationCase> &cases,
+         unsigned int threadCount = std::thread::hardware_concurrency());
+
+  /**
+   * @brief Build the cartesian product of parameter variations
+   *
+   * @param base Case that each variation modifies
+   * @param dimensions Each dimension is a list of modifications, one of which
+   * is applied per generated case
+   * @return std::vector<SimulationCase>
+   */
+  static std::vector<SimulationCase> ExpandGrid(
+      const SimulationCase &base,
+      const std::vector<std::vector<std::function<void(SimulationCase &)>>>
+          &dimensions);
+
+  /**
+   * @brief Log a line per result through the ConsoleLogger
+   *
+   * @param results
+   */
+  static void Report(const std::vector<SimulationResult> &results);
+
+  /**
+   * @brief Creates LinearSingleAxisSubsystem instances; only for meters
+   *
+   * @return SubsystemFactory
+   */
+  static SubsystemFactory LinearFactory();
+
+  /**
+   * @brief Creates RotationalSingleAxisSubsystem instances; only for degrees
+   *
+   * @param armatureLength
+   * @return SubsystemFactory
+   */
+  static SubsystemFactory RotationalFactory(units::meter_t armatureLength);
+
+private:
+  SubsystemFactory m_factory;
+};
+} // namespace subzero
@@ -1,6 +1,7 @@
 #ifndef DETECTION_PARSER_H
 #define DETECTION_PARSER_H
 
+#include <algorithm>
 #include <array>
 #include <utility>
 #include <vector>
@@ -33,11 +34,16 @@ struct DetectedObject {
   BoundingBox bbox;
 
   static std::vector<DetectedObject>
-  parse(std::vector<double> flattenedOutputList) {
+  parse(const std::vector<double> &flattenedOutputList) {
     std::vector<DetectedObject> detectedObjects;
-    detectedObjects.reserve(10);
 
-    int entryNum = flattenedOutputList.at(0);
+    // The count comes off the network, so only trust it as far as the data
+    // actually goes; reserving a garbage count could throw or allocate a lot
+    double count = flattenedOutputList.at(0);
+    int available = static_cast<int>((flattenedOutputList.size() - 1) / 6);
+    int entryNum =
+        count > 0 ? static_cast<int>(std::min<double>(count, available)) : 0;
+    detectedObjects.reserve(entryNum);
 
     for (int i = 0; i < entryNum; i++) {
       int startNum = i * 6 + 1;
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cmath>
+
+namespace subzero {
+namespace DistanceEstimation {
+/**
+ * @brief Narrower bounding boxes are treated as missing, so a bad box doesn't
+ * read as a very distant target
+ *
+ */
+inline constexpr double kMinPixelWidth = 3;
+
+typedef struct {
+  double pixelWidth;
+  /**
+   * @brief From the apparent width; 0 if the box is too narrow
+   *
+   */
+  double widthDistance;
+  /**
+   * @brief Blend of the trig and width estimates
+   *
+   */
+  double combinedDistance;
+} Estimate;
+
+/**
+ * @brief Distance to a gamepiece on the floor, blended from the camera's
+ * vertical angle to it and its apparent width. Used by TargetTracker; lengths
+ * may be in any unit as long as they all match
+ *
+ * @param verticalAngle Camera angle plus the target's vertical offset, in
+ * radians; positive = up
+ * @param cameraLensHeight Camera height above the floor
+ * @param pixelWidth Width of the target's bounding box
+ * @param gamepieceWidth
+ * @param focalLength (known distance / known width in pixels) * gamepiece width
+ * @param trigDistancePercentage From 0 to 1; the weight of the trig estimate
+ * @return Estimate
+ */
+inline Estimate EstimateDistance(double verticalAngle, double cameraLensHeight,
+                                 double pixelWidth, double gamepieceWidth,
+                                 double focalLength,
+                                 double trigDistancePercentage) {
+  double widthDistance = pixelWidth > kMinPixelWidth
+                             ? (gamepieceWidth * focalLength) / pixelWidth
+                             : 0;
+
+  double heightDelta = -cameraLensHeight;
+  double trigDistance = heightDelta / std::tan(verticalAngle);
+
+  double combinedDistance = (trigDistance * trigDistancePercentage) +
+                            (widthDistance * (1 - trigDistancePercentage));
+
+  return {.pixelWidth = pixelWidth,
+          .widthDistance = widthDistance,
+          .combinedDistance = combinedDistance};
+}
+} // namespace DistanceEstimation
+} // namespace subzero
@@ -18,8 +18,8 @@ typedef struct {
  * @param deadzoneDistance
  * @return DeadzoneAxes
  */
-DeadzoneAxes CalculateCircularDeadzone(double x, double y,
-                                       double deadzoneDistance) {
+inline DeadzoneAxes CalculateCircularDeadzone(double x, double y,
+                                              double deadzoneDistance) {
   if (std::hypot(x, y) > deadzoneDistance) {
     return {.x = x, .y = y, .deadzoneApplied = false};
   }
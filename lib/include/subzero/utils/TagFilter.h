@@ -0,0 +1,55 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace subzero {
+namespace TagFilter {
+/**
+ * @brief Selection that doesn't narrow the results
+ *
+ */
+inline constexpr std::string_view kAnyTag = "ANY";
+
+/**
+ * @brief Keep the values tagged with every selected tag, in their original
+ * order. Used by TaggedChooser; free of WPILib so it can be tested on its own
+ *
+ * @tparam TValue
+ * @param entries Each value with its set of tags
+ * @param selections One selection per group; kAnyTag is ignored
+ * @return std::vector<TValue>
+ */
+template <typename TValue>
+std::vector<TValue>
+Filter(const std::vector<std::pair<TValue, std::set<std::string>>> &entries,
+       const std::vector<std::string> &selections) {
+  std::vector<std::string_view> selectedTags;
+  for (auto &selection : selections) {
+    if (selection != kAnyTag) {
+      selectedTags.push_back(selection);
+    }
+  }
+
+  std::vector<TValue> matches;
+  for (auto &entry : entries) {
+    bool matchesAll = true;
+    for (auto &tag : selectedTags) {
+      if (!entry.second.contains(std::string{tag})) {
+        matchesAll = false;
+        break;
+      }
+    }
+
+    if (matchesAll) {
+      matches.push_back(entry.first);
+    }
+  }
+
+  return matches;
+}
+} // namespace TagFilter
+} // namespace subzero
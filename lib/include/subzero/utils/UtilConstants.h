@@ -1,5 +1,14 @@
 #pragma once
 
+/**
+ * @brief Minimum log level as an integer, e.g. -DSUBZERO_MIN_LOG_LEVEL=2 to
+ * compile out everything below WARNING
+ *
+ */
+#ifndef SUBZERO_MIN_LOG_LEVEL
+#define SUBZERO_MIN_LOG_LEVEL 0
+#endif
+
 namespace subzero {
 namespace Logging {
 /**
@@ -11,7 +20,15 @@ enum class Level { VERBOSE = 0, INFO, WARNING, ERROR, FATAL };
  * @brief Will not log messages that fall below this level
  *
  */
-constexpr auto kMinLogLevel = Level::VERBOSE;
+constexpr auto kMinLogLevel = static_cast<Level>(SUBZERO_MIN_LOG_LEVEL);
+
+/**
+ * @brief Whether messages at a level are compiled in
+ *
+ * @param level
+ * @return true if the level is at or above kMinLogLevel
+ */
+constexpr bool IsLevelEnabled(Level level) { return level >= kMinLogLevel; }
 } // namespace Logging
 
 namespace DetectionParser {
@@ -30,6 +30,8 @@
 #include <memory>
 #include <vector>
 
+#include "subzero/profiling/LoopProfiler.h"
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -698,9 +700,9 @@ inline void from_json(const wpi::json &j, LimelightResultsClass &t) {
 }
 
 inline LimelightResultsClass
-getLatestResults(const std::string &limelightName = "", bool profile = false) {
+parseResults(const std::string &jsonString, bool profile = false) {
+  SUBZERO_PROFILE_ZONE("LimelightHelpers::parseResults");
   auto start = std::chrono::high_resolution_clock::now();
-  std::string jsonString = getJSONDump(limelightName);
   wpi::json data;
   try {
     data = wpi::json::parse(jsonString);
@@ -725,6 +727,12 @@ getLatestResults(const std::string &limelightName = "", bool profile = false) {
   }
 }
 
+inline LimelightResultsClass
+getLatestResults(const std::string &limelightName = "", bool profile = false) {
+  SUBZERO_PROFILE_ZONE("LimelightHelpers::getLatestResults");
+  return parseResults(getJSONDump(limelightName), profile);
+}
+
 inline std::optional<std::vector<double>>
 getCurrentCorners(const std::string &limelightName = "") {
   auto entry = getLimelightNTDoubleArray(limelightName, "tcornxy");
@@ -6,11 +6,15 @@
 #include <photon/PhotonCamera.h>
 #include <photon/PhotonPoseEstimator.h>
 
+#include <functional>
 #include <limits>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "subzero/profiling/LoopProfiler.h"
+
 namespace subzero {
 
 /**
@@ -45,16 +49,42 @@ public:
     }
   }
 
+  /**
+   * @brief Called with every camera result read by UpdateEstimatedGlobalPose,
+   * so it can be recorded for replay
+   *
+   */
+  using ResultObserver = std::function<void(
+      const PhotonCameraEstimator &, const photon::PhotonPipelineResult &)>;
+
   std::vector<photon::EstimatedRobotPose>
   GetPosesFromCamera(frc::Pose3d prevPose, photon::PhotonPoseEstimator &est,
                      photon::PhotonCamera &camera, double maxAmbiguity = 0.2) {
+    // Photon now returns all of the poses that we haven't integrated
+    // rather than just the latest, so we must return all that are valid
+    return GetPosesFromResults(prevPose, est, camera.GetAllUnreadResults(),
+                               maxAmbiguity);
+  }
+
+  /**
+   * @brief Estimate poses from results that were already read, e.g. when
+   * replaying a log
+   *
+   * @param prevPose
+   * @param est
+   * @param results
+   * @param maxAmbiguity
+   * @return std::vector<photon::EstimatedRobotPose>
+   */
+  std::vector<photon::EstimatedRobotPose>
+  GetPosesFromResults(frc::Pose3d prevPose, photon::PhotonPoseEstimator &est,
+                      std::span<const photon::PhotonPipelineResult> results,
+                      double maxAmbiguity = 0.2) {
     est.SetReferencePose(prevPose);
 
     std::vector<photon::EstimatedRobotPose> validPoses;
 
-    // Photon now returns all of the poses that we haven't integrated
-    // rather than just the latest, so we must return all that are valid
-    for (const auto &result : camera.GetAllUnreadResults()) {
+    for (const auto &result : results) {
       // Check if the result has valid targets
       if (result.HasTargets() &&
           (result.targets.size() > 1 ||
@@ -87,23 +117,55 @@ public:
    */
   void UpdateEstimatedGlobalPose(frc::SwerveDrivePoseEstimator<4U> &estimator,
                                  bool test) {
-    for (auto &est : m_cameraEstimators) {
-      auto camPoses =
-          GetPosesFromCamera(frc::Pose3d(estimator.GetEstimatedPosition()),
-                             est.estimator, est.camera);
-      // if (camPose.has_value()) {
-      //   auto pose = camPose.value();
-      //   AddVisionMeasurement(pose, estimator, est);
-      // }
-
-      if (camPoses.size() > 0) {
-        for (auto &pose : camPoses) {
-          AddVisionMeasurement(pose, estimator, est);
+    SUBZERO_PROFILE_ZONE("PhotonVisionEstimators::UpdateEstimatedGlobalPose");
+
+    for (size_t i = 0; i < m_cameraEstimators.size(); i++) {
+      auto results = m_cameraEstimators[i].camera.GetAllUnreadResults();
+      if (m_resultObserver) {
+        for (auto &result : results) {
+          m_resultObserver(m_cameraEstimators[i], result);
         }
       }
+
+      ApplyCameraResults(estimator, i, results);
+    }
+  }
+
+  /**
+   * @brief Feed one camera's results into the pose estimator through the same
+   * path as UpdateEstimatedGlobalPose
+   *
+   * @param estimator
+   * @param cameraIndex Index into the estimators given to the constructor
+   * @param results
+   */
+  void
+  ApplyCameraResults(frc::SwerveDrivePoseEstimator<4U> &estimator,
+                     size_t cameraIndex,
+                     std::span<const photon::PhotonPipelineResult> results) {
+    auto &est = m_cameraEstimators[cameraIndex];
+    auto camPoses =
+        GetPosesFromResults(frc::Pose3d(estimator.GetEstimatedPosition()),
+                            est.estimator, results);
+
+    for (auto &pose : camPoses) {
+      AddVisionMeasurement(pose, estimator, est);
     }
   }
 
+  inline void SetResultObserver(ResultObserver observer) {
+    m_resultObserver = std::move(observer);
+  }
+
+  /**
+   * @brief Get the estimators given to the constructor
+   *
+   * @return const std::vector<PhotonCameraEstimator>&
+   */
+  inline const std::vector<PhotonCameraEstimator> &GetCameraEstimators() const {
+    return m_cameraEstimators;
+  }
+
   Eigen::Matrix<double, 3, 1>
   GetEstimationStdDevs(photon::EstimatedRobotPose &pose,
                        PhotonCameraEstimator &photonEst) {
@@ -155,6 +217,7 @@ private:
   std::vector<PhotonCameraEstimator> &m_cameraEstimators;
   Eigen::Matrix<double, 3, 1> m_singleTagStdDevs;
   Eigen::Matrix<double, 3, 1> m_multiTagStdDevs;
+  ResultObserver m_resultObserver;
 
   units::second_t lastEstTimestamp{0_s};
 };
@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "subzero/vision/LimelightHelpers.h"
@@ -171,6 +172,27 @@ public:
    */
   std::vector<DetectedObject> GetTargets();
 
+  /**
+   * @brief Get a list of all found, valid targets from already parsed
+   * Limelight results, e.g. when replaying a log
+   *
+   * @param results
+   * @return std::vector<DetectedObject>
+   */
+  std::vector<DetectedObject>
+  GetTargets(const LimelightHelpers::LimelightResultsClass &results);
+
+  /**
+   * @brief Called with every Limelight JSON dump read by GetTargets(), so it
+   * can be recorded for replay
+   *
+   * @param observer
+   */
+  inline void
+  SetInputObserver(std::function<void(const std::string &)> observer) {
+    m_inputObserver = std::move(observer);
+  }
+
   /**
    * @brief Push targets to SmartDashboard
    *
@@ -215,6 +237,19 @@ public:
   units::inch_t GetDistanceToTarget(const DetectedObject &);
 
 private:
+  struct DistanceEstimate {
+    double pixelWidth;
+    units::inch_t widthDistance;
+    units::inch_t combinedDistance;
+  };
+
+  /**
+   * @brief Estimate the distance to the target without publishing anything
+   *
+   * @return DistanceEstimate
+   */
+  DistanceEstimate EstimateDistance(const DetectedObject &target) const;
+
   /**
    * Sort targets by ASC distance to camera
    */
@@ -225,5 +260,6 @@ private:
   std::function<frc::Pose2d()> m_poseGetter;
   std::function<frc::Field2d *()> m_fieldGetter;
   std::vector<TrackedTarget> m_trackedTargets;
+  std::function<void(const std::string &)> m_inputObserver;
 };
 } // namespace subzero
\ No newline at end of file
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/kinematics/SwerveModulePosition.h>
+#include <photon/targeting/PhotonPipelineResult.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <wpi/DataLog.h>
+#include <wpi/StringMap.h>
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace subzero {
+
+/**
+ * @brief Records the inputs of the vision pipelines, along with the robot pose,
+ * the odometry inputs and any outputs worth comparing, into a DataLog so
+ * VisionReplayer can run them through the library again. Everything goes
+ * under /Replay/ in the log
+ *
+ */
+class VisionReplayRecorder {
+public:
+  /**
+   * @brief Construct a new VisionReplayRecorder
+   *
+   * @param log Defaults to the log from frc::DataLogManager
+   */
+  explicit VisionReplayRecorder(wpi::log::DataLog *log = nullptr);
+
+  /**
+   * @brief Record a Limelight JSON dump; pass this to
+   * TargetTracker::SetInputObserver
+   *
+   * @param limelightName
+   * @param json
+   */
+  void RecordLimelightJson(std::string_view limelightName,
+                           std::string_view json);
+
+  /**
+   * @brief Record a flattened detections array in the format read by
+   * DetectionParser::DetectedObject::parse
+   *
+   * @param source Name of the detector, e.g. "coral"
+   * @param detections
+   */
+  void RecordDetections(std::string_view source,
+                        std::span<const double> detections);
+
+  /**
+   * @brief Record a PhotonVision result; call from
+   * PhotonVisionEstimators::SetResultObserver. The result is logged at its NT
+   * receive time, so replaying it gives the same GetTimestamp()
+   *
+   * @param cameraName
+   * @param result
+   */
+  void RecordPhotonResult(std::string_view cameraName,
+                          const photon::PhotonPipelineResult &result);
+
+  void RecordRobotPose(const frc::Pose2d &pose);
+
+  /**
+   * @brief Record what the pose estimator's odometry update received, so a
+   * SwerveDrivePoseEstimator can be rebuilt headlessly; call next to
+   * UpdateWithTime()
+   *
+   * @param gyroAngle
+   * @param modulePositions
+   */
+  void RecordOdometry(
+      const frc::Rotation2d &gyroAngle,
+      std::span<const frc::SwerveModulePosition> modulePositions);
+
+  /**
+   * @brief Record an output of the live code, used as the reference when
+   * replaying
+   *
+   * @param name
+   * @param pose
+   */
+  void RecordOutput(std::string_view name, const frc::Pose2d &pose);
+
+private:
+  template <typename TEntry>
+  TEntry &getEntry(wpi::StringMap<TEntry> &entries, std::string_view prefix,
+                   std::string_view name) {
+    std::string fullName{prefix};
+    fullName += name;
+
+    auto it = entries.find(fullName);
+    if (it == entries.end()) {
+      it = entries.try_emplace(fullName, m_log, fullName).first;
+    }
+    return it->second;
+  }
+
+  wpi::log::DataLog &m_log;
+  wpi::StringMap<wpi::log::StringLogEntry> m_jsonEntries;
+  wpi::StringMap<wpi::log::DoubleArrayLogEntry> m_detectionEntries;
+  wpi::StringMap<wpi::log::RawLogEntry> m_photonEntries;
+  wpi::StringMap<wpi::log::StructLogEntry<frc::Pose2d>> m_poseEntries;
+  /**
+   * @brief Created on first use, like the other entries
+   *
+   */
+  std::optional<wpi::log::StructLogEntry<frc::Rotation2d>> m_gyroEntry;
+  std::optional<wpi::log::StructArrayLogEntry<frc::SwerveModulePosition>>
+      m_moduleEntry;
+};
+
+/**
+ * @brief Callbacks for each kind of recorded input; unset ones are skipped.
+ * Wire them to the same library code that runs on the robot
+ *
+ */
+struct VisionReplayHandlers {
+  std::function<void(units::second_t, std::string_view limelightName,
+                     const std::string &json)>
+      limelightJson;
+  std::function<void(units::second_t, std::string_view source,
+                     const std::vector<double> &detections)>
+      detections;
+  std::function<void(units::second_t, std::string_view cameraName,
+                     const photon::PhotonPipelineResult &result)>
+      photonResult;
+  std::function<void(units::second_t, const frc::Pose2d &pose)> robotPose;
+  std::function<void(units::second_t, const frc::Rotation2d &gyroAngle,
+                     std::span<const frc::SwerveModulePosition>
+                         modulePositions)>
+      odometry;
+};
+
+struct VisionReplayStats {
+  size_t records;
+  /**
+   * @brief Match time covered by the replayed records
+   *
+   */
+  units::second_t logDuration;
+  /**
+   * @brief Time spent in the handlers
+   *
+   */
+  units::second_t wallTime;
+  double recordsPerSecond;
+};
+
+/**
+ * @brief Reads a log written by VisionReplayRecorder and replays it through
+ * handlers headlessly, as fast as possible and always in the same order.
+ * Outputs produced during the replay can be compared with the ones recorded
+ * live
+ *
+ */
+class VisionReplayer {
+public:
+  struct OutputComparison {
+    size_t samples = 0;
+    /**
+     * @brief Samples further than the tolerance from the reference
+     *
+     */
+    size_t mismatches = 0;
+    units::meter_t maxError = 0_m;
+    units::meter_t totalError = 0_m;
+  };
+
+  /**
+   * @brief Load and decode every replay record from a log file
+   *
+   * @param path
+   * @return std::nullopt if the file couldn't be read
+   */
+  static std::optional<VisionReplayer> Load(std::string_view path);
+
+  /**
+   * @brief Replay every record in timestamp order
+   *
+   * @param handlers
+   * @return VisionReplayStats
+   */
+  VisionReplayStats Run(const VisionReplayHandlers &handlers) const;
+
+  /**
+   * @brief Compare an output from the replay with the recorded one closest in
+   * time
+   *
+   * @param name Name given to VisionReplayRecorder::RecordOutput
+   * @param timestamp Timestamp of the input that produced the output
+   * @param actual
+   * @param tolerance
+   */
+  void CompareOutput(std::string_view name, units::second_t timestamp,
+                     const frc::Pose2d &actual,
+                     units::meter_t tolerance = 1_cm);
+
+  inline const wpi::StringMap<OutputComparison> &GetComparisons() const {
+    return m_comparisons;
+  }
+
+  /**
+   * @brief Log the throughput and comparison results through the
+   * ConsoleLogger
+   *
+   * @param stats
+   */
+  void Report(const VisionReplayStats &stats) const;
+
+private:
+  enum class RecordKind {
+    LimelightJson,
+    Detections,
+    PhotonResult,
+    RobotPose,
+    Odometry
+  };
+
+  struct OdometryInputs {
+    frc::Rotation2d gyroAngle;
+    std::vector<frc::SwerveModulePosition> modulePositions;
+  };
+
+  struct Record {
+    int64_t timestamp;
+    RecordKind kind;
+    std::string source;
+    std::variant<std::string, std::vector<double>,
+                 photon::PhotonPipelineResult, frc::Pose2d, OdometryInputs>
+        value;
+  };
+
+  VisionReplayer() = default;
+
+  std::vector<Record> m_records;
+  /**
+   * @brief Recorded outputs by name, sorted by timestamp
+   *
+   */
+  wpi::StringMap<std::vector<std::pair<int64_t, frc::Pose2d>>> m_references;
+  wpi::StringMap<OutputComparison> m_comparisons;
+};
+} // namespace subzero
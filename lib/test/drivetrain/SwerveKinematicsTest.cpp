@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "subzero/drivetrain/SwerveKinematics.h"
+
+using namespace subzero;
+
+constexpr double kPi = std::numbers::pi;
+
+// Front left, front right, back left, back right
+const SwerveKinematics<4> kKinematics{
+    {{{0.3, 0.3}, {0.3, -0.3}, {-0.3, 0.3}, {-0.3, -0.3}}}};
+
+TEST(SwerveKinematicsTest, TranslationPointsEveryModuleTheSameWay) {
+  auto moduleSpeeds = kKinematics.ToModuleSpeeds({0, 2, 0});
+
+  for (auto &moduleSpeed : moduleSpeeds) {
+    EXPECT_DOUBLE_EQ(moduleSpeed.speed, 2);
+    EXPECT_DOUBLE_EQ(moduleSpeed.angle, kPi / 2);
+  }
+}
+
+TEST(SwerveKinematicsTest, RotationIsTangentToTheCenter) {
+  auto vectors = kKinematics.ToModuleVectors({0, 0, 1});
+
+  // The front left module moves back and left when turning counter-clockwise
+  EXPECT_DOUBLE_EQ(vectors[0].vx, -0.3);
+  EXPECT_DOUBLE_EQ(vectors[0].vy, 0.3);
+  EXPECT_DOUBLE_EQ(vectors[3].vx, 0.3);
+  EXPECT_DOUBLE_EQ(vectors[3].vy, -0.3);
+}
+
+TEST(SwerveKinematicsTest, DesaturateKeepsTheRatios) {
+  SwerveKinematics<4>::ModuleSpeeds moduleSpeeds{
+      {{4, 0}, {-2, 0}, {1, 0}, {0, 0}}};
+
+  SwerveKinematics<4>::DesaturateWheelSpeeds(moduleSpeeds, 2);
+
+  EXPECT_DOUBLE_EQ(moduleSpeeds[0].speed, 2);
+  EXPECT_DOUBLE_EQ(moduleSpeeds[1].speed, -1);
+  EXPECT_DOUBLE_EQ(moduleSpeeds[2].speed, 0.5);
+  EXPECT_DOUBLE_EQ(moduleSpeeds[3].speed, 0);
+}
+
+TEST(SwerveKinematicsTest, OptimizeReversesInsteadOfTurningAround) {
+  auto optimized = SwerveKinematics<4>::Optimize({1, kPi}, 0.1);
+
+  EXPECT_NEAR(optimized.angle, 0, 1e-12);
+  EXPECT_NEAR(optimized.speed, -std::cos(0.1), 1e-12);
+}
+
+TEST(SwerveKinematicsTest, DiscretizeLeavesPureTranslationAlone) {
+  auto discretized = SwerveKinematics<4>::Discretize({1, 2, 0}, 0.02);
+
+  EXPECT_DOUBLE_EQ(discretized.vx, 1);
+  EXPECT_DOUBLE_EQ(discretized.vy, 2);
+  EXPECT_DOUBLE_EQ(discretized.omega, 0);
+}
+
+namespace {
+// A module layout whose center isn't the robot's, which exercises the cross
+// terms of the least-squares fit
+const SwerveKinematics<3> kOffsetKinematics{
+    {{{0.4, 0.1}, {-0.2, 0.35}, {-0.1, -0.3}}}};
+
+std::vector<SwerveChassisSpeeds> RandomSpeeds() {
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> linear{-4, 4};
+  std::uniform_real_distribution<double> angular{-10, 10};
+
+  std::vector<SwerveChassisSpeeds> speeds;
+  for (int i = 0; i < 1000; i++) {
+    speeds.push_back(
+        {linear(generator), linear(generator), angular(generator)});
+  }
+  return speeds;
+}
+
+template <size_t N>
+void ExpectRoundTrip(const SwerveKinematics<N> &kinematics) {
+  for (auto &speeds : RandomSpeeds()) {
+    auto fromVectors =
+        kinematics.ToChassisSpeeds(kinematics.ToModuleVectors(speeds));
+    EXPECT_NEAR(fromVectors.vx, speeds.vx, 1e-9);
+    EXPECT_NEAR(fromVectors.vy, speeds.vy, 1e-9);
+    EXPECT_NEAR(fromVectors.omega, speeds.omega, 1e-9);
+
+    auto fromSpeeds =
+        kinematics.ToChassisSpeeds(kinematics.ToModuleSpeeds(speeds));
+    EXPECT_NEAR(fromSpeeds.vx, speeds.vx, 1e-9);
+    EXPECT_NEAR(fromSpeeds.vy, speeds.vy, 1e-9);
+    EXPECT_NEAR(fromSpeeds.omega, speeds.omega, 1e-9);
+  }
+}
+} // namespace
+
+TEST(SwerveKinematicsTest, ForwardInverseRoundTrip) {
+  ExpectRoundTrip(kKinematics);
+}
+
+TEST(SwerveKinematicsTest, ForwardInverseRoundTripWithOffsetModules) {
+  ExpectRoundTrip(kOffsetKinematics);
+}
+
+TEST(SwerveKinematicsTest, ForwardKinematicsFitsNoisyModules) {
+  auto vectors = kKinematics.ToModuleVectors({1, 0.5, 2});
+  // One module slipping; the fit spreads the error instead of following it
+  vectors[0].vx += 0.4;
+
+  auto speeds = kKinematics.ToChassisSpeeds(vectors);
+
+  EXPECT_NEAR(speeds.vx, 1.1, 1e-9);
+  EXPECT_NEAR(speeds.vy, 0.5, 1e-9);
+}
+
+TEST(SwerveKinematicsTest, DiscretizedSpeedsEndAtTheContinuousPose) {
+  constexpr double kDt = 0.02;
+
+  for (auto &speeds : RandomSpeeds()) {
+    auto discretized = SwerveKinematics<4>::Discretize(speeds, kDt);
+
+    // Holding the discretized speeds follows an arc; integrate it exactly
+    double dx = discretized.vx * kDt;
+    double dy = discretized.vy * kDt;
+    double dtheta = discretized.omega * kDt;
+    double s = std::sin(dtheta) / dtheta;
+    double c = (1 - std::cos(dtheta)) / dtheta;
+
+    EXPECT_NEAR(dx * s - dy * c, speeds.vx * kDt, 1e-9);
+    EXPECT_NEAR(dx * c + dy * s, speeds.vy * kDt, 1e-9);
+    EXPECT_EQ(discretized.omega, speeds.omega);
+  }
+}
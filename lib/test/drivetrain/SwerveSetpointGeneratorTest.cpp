@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+
+#include "subzero/drivetrain/SwerveSetpointGenerator.h"
+
+using namespace subzero;
+
+constexpr double kPi = std::numbers::pi;
+constexpr double kDt = 0.02;
+
+const SwerveKinematics<4> kKinematics{
+    {{{0.3, 0.3}, {0.3, -0.3}, {-0.3, 0.3}, {-0.3, -0.3}}}};
+constexpr SwerveModuleLimits kLimits{
+    .maxWheelSpeed = 4, .maxWheelAcceleration = 10, .maxSteerRate = 10};
+
+TEST(SwerveSetpointGeneratorTest, ReachableSpeedsAreReturnedAsIs) {
+  SwerveSetpointGenerator<4> generator{kKinematics, kLimits};
+  SwerveSetpoint<4> previous{{0.1, 0, 0},
+                             kKinematics.ToModuleSpeeds({0.1, 0, 0})};
+
+  auto setpoint = generator.Generate(previous, {0.2, 0, 0}, kDt);
+
+  EXPECT_NEAR(setpoint.chassisSpeeds.vx, 0.2, 1e-9);
+  EXPECT_NEAR(setpoint.chassisSpeeds.vy, 0, 1e-9);
+}
+
+TEST(SwerveSetpointGeneratorTest, LimitsWheelAcceleration) {
+  SwerveSetpointGenerator<4> generator{kKinematics, kLimits};
+  SwerveSetpoint<4> previous{{1, 0, 0}, kKinematics.ToModuleSpeeds({1, 0, 0})};
+
+  auto setpoint = generator.Generate(previous, {4, 0, 0}, kDt);
+
+  // No more than maxWheelAcceleration * dt = 0.2 m/s faster
+  EXPECT_GT(setpoint.chassisSpeeds.vx, 1);
+  EXPECT_LE(setpoint.chassisSpeeds.vx, 1.2 + 1e-9);
+}
+
+TEST(SwerveSetpointGeneratorTest, TurnsTheWheelsBeforeMovingFromAStop) {
+  SwerveSetpointGenerator<4> generator{kKinematics, kLimits};
+  SwerveSetpoint<4> previous{};
+
+  // Driving sideways needs a quarter turn, more than one step of steering
+  auto setpoint = generator.Generate(previous, {0, 1, 0}, kDt);
+
+  EXPECT_EQ(setpoint.chassisSpeeds.vx, 0);
+  EXPECT_EQ(setpoint.chassisSpeeds.vy, 0);
+  for (auto &moduleSpeed : setpoint.moduleSpeeds) {
+    EXPECT_EQ(moduleSpeed.speed, 0);
+    EXPECT_NEAR(std::abs(moduleSpeed.angle), kLimits.maxSteerRate * kDt,
+                1e-12);
+  }
+}
+
+TEST(SwerveSetpointGeneratorTest, EveryStepIsWithinTheModuleLimits) {
+  SwerveSetpointGenerator<4> generator{kKinematics, kLimits};
+  SwerveSetpoint<4> setpoint{};
+
+  for (int i = 0; i < 200; i++) {
+    auto next = generator.Generate(setpoint, {2, -1, 3}, kDt);
+    for (size_t module = 0; module < 4; module++) {
+      double steer = std::abs(std::remainder(
+          next.moduleSpeeds[module].angle - setpoint.moduleSpeeds[module].angle,
+          2 * kPi));
+      EXPECT_LE(steer, kLimits.maxSteerRate * kDt + 1e-9);
+      EXPECT_LE(std::abs(next.moduleSpeeds[module].speed),
+                kLimits.maxWheelSpeed + 1e-9);
+    }
+    setpoint = next;
+  }
+
+  // Desaturation may slow the chassis, but the direction is kept
+  EXPECT_NEAR(setpoint.chassisSpeeds.vx / setpoint.chassisSpeeds.vy, -2, 1e-6);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "subzero/drivetrain/SwerveUtils.h"
+
+using namespace subzero;
+
+constexpr double kPi = std::numbers::pi;
+
+TEST(SwerveUtilsTest, StepTowards) {
+  EXPECT_DOUBLE_EQ(SwerveUtils::StepTowards(0, 1, 0.25), 0.25);
+  EXPECT_DOUBLE_EQ(SwerveUtils::StepTowards(0, -1, 0.25), -0.25);
+  EXPECT_DOUBLE_EQ(SwerveUtils::StepTowards(0.9, 1, 0.25), 1);
+}
+
+TEST(SwerveUtilsTest, WrapAngle) {
+  EXPECT_DOUBLE_EQ(SwerveUtils::WrapAngle(2 * kPi), 0);
+  EXPECT_DOUBLE_EQ(SwerveUtils::WrapAngle(-kPi / 2), 3 * kPi / 2);
+  EXPECT_NEAR(SwerveUtils::WrapAngle(5 * kPi), kPi, 1e-12);
+  EXPECT_DOUBLE_EQ(SwerveUtils::WrapAngle(1), 1);
+}
+
+TEST(SwerveUtilsTest, AngleDifferenceCrossesZero) {
+  EXPECT_NEAR(SwerveUtils::AngleDifference(0.1, 2 * kPi - 0.1), 0.2, 1e-12);
+  EXPECT_DOUBLE_EQ(SwerveUtils::AngleDifference(1, 2), 1);
+}
+
+TEST(SwerveUtilsTest, StepTowardsCircularTakesTheShortWay) {
+  // Stepping from just above 0 to just below 2 pi goes backwards through 0
+  double next = SwerveUtils::StepTowardsCircular(0.1, 2 * kPi - 1, 0.5);
+  EXPECT_NEAR(next, 2 * kPi - 0.4, 1e-12);
+
+  EXPECT_DOUBLE_EQ(SwerveUtils::StepTowardsCircular(1, 2, 0.5), 1.5);
+  EXPECT_DOUBLE_EQ(SwerveUtils::StepTowardsCircular(1, 1.2, 0.5), 1.2);
+}
+
+namespace {
+std::vector<double> TestAngles() {
+  // Edge cases first, then angles a few turns either side of 0
+  std::vector<double> angles{0,        -0.0,    kPi,   -kPi,   2 * kPi,
+                             -2 * kPi, 4 * kPi, 1e-12, -1e-12, kPi / 2};
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> distribution{-6 * kPi, 6 * kPi};
+  for (int i = 0; i < 10000; i++) {
+    angles.push_back(distribution(generator));
+  }
+  return angles;
+}
+
+uint64_t Bits(double value) { return std::bit_cast<uint64_t>(value); }
+} // namespace
+
+TEST(SwerveUtilsTest, BatchAngleDifferenceMatchesScalar) {
+  auto a = TestAngles();
+  auto b = a;
+  std::shuffle(b.begin(), b.end(), std::mt19937{7});
+  std::vector<double> out(a.size());
+
+  SwerveUtils::AngleDifference(a, b, out);
+
+  for (size_t i = 0; i < a.size(); i++) {
+    ASSERT_EQ(Bits(out[i]), Bits(SwerveUtils::AngleDifference(a[i], b[i])))
+        << a[i] << ", " << b[i];
+  }
+}
+
+TEST(SwerveUtilsTest, BatchWorksInPlace) {
+  std::vector<double> a{0.0, kPi / 2};
+  std::vector<double> b{3 * kPi / 2, kPi / 4};
+
+  SwerveUtils::AngleDifference(a, b, a);
+
+  EXPECT_DOUBLE_EQ(a[0], kPi / 2);
+  EXPECT_DOUBLE_EQ(a[1], kPi / 4);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "subzero/logging/AsyncLogBackend.h"
+
+using namespace subzero;
+
+namespace {
+bool PushFormatted(Logging::Level level, std::string_view key,
+                   const char *format, ...) {
+  va_list ap;
+  va_start(ap, format);
+  bool queued = AsyncLogBackend::getInstance().Push(level, key, format, ap);
+  va_end(ap);
+  return queued;
+}
+} // namespace
+
+TEST(AsyncLogBackendTest, WritesRecordsInOrder) {
+  auto &backend = AsyncLogBackend::getInstance();
+
+  testing::internal::CaptureStdout();
+  EXPECT_TRUE(PushFormatted(Logging::Level::INFO, "Arm", "at %d degrees", 42));
+  EXPECT_TRUE(backend.Push(Logging::Level::ERROR, "Elevator", "stalled"));
+  backend.Flush();
+  std::string output = testing::internal::GetCapturedStdout();
+
+  size_t first = output.find("INFO - Arm: at 42 degrees\n");
+  size_t second = output.find("ERROR - Elevator: stalled\n");
+  ASSERT_NE(first, std::string::npos) << output;
+  ASSERT_NE(second, std::string::npos) << output;
+  EXPECT_LT(first, second);
+}
+
+TEST(AsyncLogBackendTest, StampsRecordsWhenPushed) {
+  auto &backend = AsyncLogBackend::getInstance();
+
+  testing::internal::CaptureStdout();
+  backend.Push(Logging::Level::INFO, "First", "message");
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  backend.Push(Logging::Level::INFO, "Second", "message");
+  backend.Flush();
+  std::string output = testing::internal::GetCapturedStdout();
+
+  // [seconds since startup] LEVEL - key: message
+  std::regex firstLine{R"(\[(\d+\.\d{6})\] INFO - First: message)"};
+  std::regex secondLine{R"(\[(\d+\.\d{6})\] INFO - Second: message)"};
+  std::smatch first, second;
+  ASSERT_TRUE(std::regex_search(output, first, firstLine)) << output;
+  ASSERT_TRUE(std::regex_search(output, second, secondLine)) << output;
+  EXPECT_GE(std::stod(second[1]) - std::stod(first[1]), 0.05);
+}
+
+TEST(AsyncLogBackendTest, TruncatesLongMessages) {
+  auto &backend = AsyncLogBackend::getInstance();
+  std::string longMessage(AsyncLogBackend::kMaxMessageLength * 2, 'x');
+
+  testing::internal::CaptureStdout();
+  backend.Push(Logging::Level::WARNING, "Key", longMessage);
+  backend.Flush();
+  std::string output = testing::internal::GetCapturedStdout();
+
+  std::string truncated(AsyncLogBackend::kMaxMessageLength - 1, 'x');
+  EXPECT_NE(output.find("WARNING - Key: " + truncated + "\n"),
+            std::string::npos);
+}
+
+TEST(AsyncLogBackendTest, ManyThreadsCanPushAtOnce) {
+  auto &backend = AsyncLogBackend::getInstance();
+  constexpr int kThreads = 4;
+  constexpr int kRecordsPerThread = 200;
+  uint64_t droppedBefore = backend.GetDroppedCount();
+
+  testing::internal::CaptureStdout();
+  std::vector<std::thread> threads;
+  int queued[kThreads] = {};
+  for (int i = 0; i < kThreads; i++) {
+    threads.emplace_back([i, &queued] {
+      for (int j = 0; j < kRecordsPerThread; j++) {
+        queued[i] +=
+            PushFormatted(Logging::Level::VERBOSE, "Thread", "%d %d", i, j);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  backend.Flush();
+  std::string output = testing::internal::GetCapturedStdout();
+
+  // Every record is either written or counted as dropped
+  int written = 0;
+  for (size_t i = output.find("VERBOSE - Thread"); i != std::string::npos;
+       i = output.find("VERBOSE - Thread", i + 1)) {
+    written++;
+  }
+  int total = queued[0] + queued[1] + queued[2] + queued[3];
+  EXPECT_EQ(written, total);
+  EXPECT_EQ(kThreads * kRecordsPerThread - total,
+            backend.GetDroppedCount() - droppedBefore);
+}
+
+TEST(AsyncLogBackendTest, WritesWhilePaused) {
+  auto &backend = AsyncLogBackend::getInstance();
+  backend.SetPaused(true);
+
+  testing::internal::CaptureStdout();
+  backend.Push(Logging::Level::INFO, "Parked", "pushed");
+  // A push wakes the writer on its own
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  std::string pushed = testing::internal::GetCapturedStdout();
+
+  testing::internal::CaptureStdout();
+  backend.Push(Logging::Level::INFO, "Parked", "flushed");
+  backend.Flush();
+  std::string flushed = testing::internal::GetCapturedStdout();
+  backend.SetPaused(false);
+
+  EXPECT_NE(pushed.find("INFO - Parked: pushed\n"), std::string::npos);
+  EXPECT_NE(flushed.find("INFO - Parked: flushed\n"), std::string::npos);
+}
+
+TEST(AsyncLogBackendTest, TimestampMatchesQueuedLines) {
+  std::string line;
+  AsyncLogBackend::AppendTimestamp(line, std::chrono::steady_clock::now());
+
+  EXPECT_TRUE(std::regex_match(line, std::regex{R"(\[\d+\.\d{6}\] )"}))
+      << line;
+}
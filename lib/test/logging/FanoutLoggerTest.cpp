@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+
+#include "subzero/logging/FanoutLogger.h"
+
+using namespace subzero;
+using namespace Logging;
+
+namespace {
+// Counts what reaches it, per level
+class CountingLogger : public ILogger {
+public:
+  std::array<int, 5> counts{};
+
+  void logVerbose(std::string, const std::string, ...) override {
+    count(Level::VERBOSE);
+  }
+  void logInfo(std::string, const std::string, ...) override {
+    count(Level::INFO);
+  }
+  void logWarning(std::string, const std::string, ...) override {
+    count(Level::WARNING);
+  }
+  void logError(std::string, const std::string, ...) override {
+    count(Level::ERROR);
+  }
+  void logFatal(std::string, const std::string, ...) override {
+    count(Level::FATAL);
+  }
+
+  void logVerbose(std::string, int) override { count(Level::VERBOSE); }
+  void logInfo(std::string, int) override { count(Level::INFO); }
+  void logWarning(std::string, int) override { count(Level::WARNING); }
+  void logError(std::string, int) override { count(Level::ERROR); }
+  void logFatal(std::string, int) override { count(Level::FATAL); }
+
+  void logVerbose(std::string, double) override { count(Level::VERBOSE); }
+  void logInfo(std::string, double) override { count(Level::INFO); }
+  void logWarning(std::string, double) override { count(Level::WARNING); }
+  void logError(std::string, double) override { count(Level::ERROR); }
+  void logFatal(std::string, double) override { count(Level::FATAL); }
+
+  void logInfo(std::string, bool) override { count(Level::INFO); }
+  void logVerbose(std::string, bool) override { count(Level::VERBOSE); }
+  void logWarning(std::string, bool) override { count(Level::WARNING); }
+  void logError(std::string, bool) override { count(Level::ERROR); }
+  void logFatal(std::string, bool) override { count(Level::FATAL); }
+
+  void logInfo(std::string, frc::Pose2d &) override { count(Level::INFO); }
+  void logVerbose(std::string, frc::Pose2d &) override {
+    count(Level::VERBOSE);
+  }
+  void logWarning(std::string, frc::Pose2d &) override {
+    count(Level::WARNING);
+  }
+  void logError(std::string, frc::Pose2d &) override { count(Level::ERROR); }
+  void logFatal(std::string, frc::Pose2d &) override { count(Level::FATAL); }
+
+  void logInfo(std::string, wpi::Sendable *) override { count(Level::INFO); }
+  void logVerbose(std::string, wpi::Sendable *) override {
+    count(Level::VERBOSE);
+  }
+  void logWarning(std::string, wpi::Sendable *) override {
+    count(Level::WARNING);
+  }
+  void logError(std::string, wpi::Sendable *) override {
+    count(Level::ERROR);
+  }
+  void logFatal(std::string, wpi::Sendable *) override {
+    count(Level::FATAL);
+  }
+
+  void logMessage(Level level, std::string_view,
+                  std::string_view) override {
+    count(level);
+  }
+
+  int Count(Level level) const { return counts[static_cast<int>(level)]; }
+
+private:
+  void count(Level level) { counts[static_cast<int>(level)]++; }
+};
+
+class FanoutLoggerTest : public testing::Test {
+protected:
+  void SetUp() override { FanoutLogger::getInstance().ClearSinks(); }
+  void TearDown() override { FanoutLogger::getInstance().ClearSinks(); }
+
+  CountingLogger sink;
+};
+} // namespace
+
+TEST_F(FanoutLoggerTest, RateLimitsOnlyChattyLevels) {
+  auto &logger = FanoutLogger::getInstance();
+  logger.AddSink(&sink, {.minPeriodPerKey = 1_s});
+
+  for (int i = 0; i < 3; i++) {
+    logger.logInfo("Key", i);
+    logger.logWarning("Key", i);
+    logger.logError("Key", i);
+    logger.logFatal("Key", i);
+  }
+
+  EXPECT_EQ(sink.Count(Level::INFO), 1);
+  EXPECT_EQ(sink.Count(Level::WARNING), 3);
+  EXPECT_EQ(sink.Count(Level::ERROR), 3);
+  EXPECT_EQ(sink.Count(Level::FATAL), 3);
+}
+
+TEST_F(FanoutLoggerTest, SamplesOnlyChattyLevels) {
+  auto &logger = FanoutLogger::getInstance();
+  logger.AddSink(&sink, {.sampleEvery = 2});
+
+  for (int i = 0; i < 4; i++) {
+    logger.logVerbose("Key", 1.0);
+    logger.logError("Key", 1.0);
+  }
+
+  EXPECT_EQ(sink.Count(Level::VERBOSE), 2);
+  EXPECT_EQ(sink.Count(Level::ERROR), 4);
+}
+
+TEST_F(FanoutLoggerTest, UnfilteredLevelIsConfigurable) {
+  auto &logger = FanoutLogger::getInstance();
+  logger.AddSink(&sink, {.minPeriodPerKey = 1_s,
+                         .unfilteredLevel = Level::FATAL});
+
+  for (int i = 0; i < 3; i++) {
+    logger.logError("Key", true);
+    logger.logFatal("Key", true);
+  }
+
+  EXPECT_EQ(sink.Count(Level::ERROR), 1);
+  EXPECT_EQ(sink.Count(Level::FATAL), 3);
+}
+
+TEST_F(FanoutLoggerTest, MinLevelStillApplies) {
+  auto &logger = FanoutLogger::getInstance();
+  logger.AddSink(&sink, {.minLevel = Level::FATAL});
+
+  logger.logError("Key", 1);
+  logger.logFatal("Key", 1);
+
+  EXPECT_EQ(sink.Count(Level::ERROR), 0);
+  EXPECT_EQ(sink.Count(Level::FATAL), 1);
+}
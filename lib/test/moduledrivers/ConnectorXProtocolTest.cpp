@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include "subzero/moduledrivers/ConnectorXProtocol.h"
+
+using namespace ConnectorX::Commands;
+
+TEST(ConnectorXProtocolTest, CommandWithoutDataIsOnlyTheType) {
+  Command command{.commandType = CommandType::Off, .commandData = {}};
+
+  EncodedCommand encoded = Encode(command);
+
+  EXPECT_EQ(encoded.length, 1);
+  EXPECT_EQ(encoded.data[0], static_cast<uint8_t>(CommandType::Off));
+  EXPECT_EQ(encoded.responseSize, 0);
+}
+
+TEST(ConnectorXProtocolTest, ReadCommandsExpectAResponse) {
+  Command command{.commandType = CommandType::ReadAnalog, .commandData = {}};
+  command.commandData.commandReadAnalog = {.port = 3};
+
+  EncodedCommand encoded = Encode(command);
+
+  EXPECT_EQ(encoded.length, 2);
+  EXPECT_EQ(encoded.data[1], 3);
+  EXPECT_EQ(encoded.responseSize, sizeof(ResponseReadAnalog));
+
+  command.commandType = CommandType::ReadConfig;
+  EXPECT_EQ(Encode(command).responseSize, sizeof(ResponseReadConfiguration));
+}
+
+TEST(ConnectorXProtocolTest, CopiesTheCommandData) {
+  Command command{.commandType = CommandType::ChangeColor, .commandData = {}};
+  command.commandData.commandColor = {.red = 10, .green = 20, .blue = 30};
+
+  EncodedCommand encoded = Encode(command);
+
+  ASSERT_EQ(encoded.length, 1 + sizeof(CommandColor));
+  EXPECT_EQ(encoded.data[0], static_cast<uint8_t>(CommandType::ChangeColor));
+  EXPECT_EQ(encoded.data[1], 10);
+  EXPECT_EQ(encoded.data[2], 20);
+  EXPECT_EQ(encoded.data[3], 30);
+  EXPECT_EQ(encoded.responseSize, 0);
+}
+
+TEST(ConnectorXProtocolTest, SendsOnlyTheUsedZones) {
+  Command command{.commandType = CommandType::SetNewZones, .commandData = {}};
+  command.commandData.commandSetNewZones.zoneCount = 2;
+  command.commandData.commandSetNewZones.zones[0] = {.offset = 0, .count = 4};
+  command.commandData.commandSetNewZones.zones[1] = {.offset = 4, .count = 8};
+
+  EncodedCommand encoded = Encode(command);
+
+  EXPECT_EQ(encoded.length, 1 + sizeof(uint8_t) + 2 * sizeof(NewZone));
+
+  command.commandType = CommandType::SyncStates;
+  command.commandData.commandSyncZoneStates.zoneCount = 3;
+  EXPECT_EQ(Encode(command).length, 1 + sizeof(uint8_t) + 3);
+}
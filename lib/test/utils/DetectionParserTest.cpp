@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "subzero/utils/DetectionParser.h"
+
+using namespace subzero::DetectionParser;
+
+TEST(DetectionParserTest, ParsesEveryEntry) {
+  // [count, (classId, confidence, topLeftY, topLeftX, bottomRightY,
+  // bottomRightX)...]
+  std::vector<double> flattened{2,   1,   0.9, 10,  20,  50,  80,
+                                0,   0.5, 100, 200, 150, 260};
+
+  auto objects = DetectedObject::parse(flattened);
+
+  ASSERT_EQ(objects.size(), 2u);
+  EXPECT_EQ(objects[0].classId, ObjectClasses::Cube);
+  EXPECT_DOUBLE_EQ(objects[0].confidence, 0.9);
+  EXPECT_DOUBLE_EQ(objects[0].bbox.topLeft.first, 20);
+  EXPECT_DOUBLE_EQ(objects[0].bbox.topLeft.second, 10);
+  EXPECT_DOUBLE_EQ(objects[0].bbox.bottomRight.first, 80);
+  EXPECT_DOUBLE_EQ(objects[0].bbox.bottomRight.second, 50);
+  EXPECT_DOUBLE_EQ(objects[0].bbox.width, 60);
+  EXPECT_DOUBLE_EQ(objects[0].bbox.height, 40);
+
+  EXPECT_EQ(objects[1].classId, ObjectClasses::Cone);
+  EXPECT_DOUBLE_EQ(objects[1].bbox.width, 60);
+  EXPECT_DOUBLE_EQ(objects[1].bbox.height, 50);
+}
+
+TEST(DetectionParserTest, NoDetections) {
+  EXPECT_TRUE(DetectedObject::parse({0}).empty());
+}
+
+TEST(DetectionParserTest, NegativeCountIsEmpty) {
+  EXPECT_TRUE(DetectedObject::parse({-1, 1, 0.9, 10, 20, 50, 80}).empty());
+}
+
+TEST(DetectionParserTest, CountIsLimitedToTheEntriesPresent) {
+  // Claims a million entries but carries one and a half
+  std::vector<double> flattened{1e6, 1, 0.9, 10, 20, 50, 80, 0, 0.5, 100};
+
+  auto objects = DetectedObject::parse(flattened);
+
+  ASSERT_EQ(objects.size(), 1u);
+  EXPECT_EQ(objects[0].classId, ObjectClasses::Cube);
+}
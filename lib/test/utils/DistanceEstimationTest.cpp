@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+
+#include "subzero/utils/DistanceEstimation.h"
+
+using namespace subzero;
+
+namespace {
+constexpr double kDegToRad = std::numbers::pi / 180;
+} // namespace
+
+TEST(DistanceEstimationTest, TrigOnlyMatchesGeometry) {
+  // 20 in above the floor, looking 45 degrees down: 20 in away
+  auto estimate = DistanceEstimation::EstimateDistance(
+      -45 * kDegToRad, 20, 100, 14, 50, 1.0);
+
+  EXPECT_NEAR(estimate.combinedDistance, 20, 1e-9);
+}
+
+TEST(DistanceEstimationTest, WidthOnlyScalesWithPixelWidth) {
+  auto estimate = DistanceEstimation::EstimateDistance(
+      -45 * kDegToRad, 20, 70, 14, 50, 0.0);
+
+  EXPECT_DOUBLE_EQ(estimate.widthDistance, 10);
+  EXPECT_DOUBLE_EQ(estimate.combinedDistance, 10);
+  EXPECT_DOUBLE_EQ(estimate.pixelWidth, 70);
+}
+
+TEST(DistanceEstimationTest, BlendsTheTwoEstimates) {
+  auto estimate = DistanceEstimation::EstimateDistance(
+      -45 * kDegToRad, 20, 70, 14, 50, 0.25);
+
+  EXPECT_NEAR(estimate.combinedDistance, 0.25 * 20 + 0.75 * 10, 1e-9);
+}
+
+TEST(DistanceEstimationTest, NarrowBoxesHaveNoWidthEstimate) {
+  auto estimate = DistanceEstimation::EstimateDistance(
+      -45 * kDegToRad, 20, DistanceEstimation::kMinPixelWidth, 14, 50, 0.5);
+
+  EXPECT_EQ(estimate.widthDistance, 0);
+  EXPECT_NEAR(estimate.combinedDistance, 10, 1e-9);
+}
@@ -0,0 +1,22 @@
+#include <gtest/gtest.h>
+
+#include "subzero/utils/InputUtils.h"
+
+using namespace subzero::InputUtils;
+
+TEST(InputUtilsTest, ZeroesInputsInsideTheDeadzone) {
+  auto axes = CalculateCircularDeadzone(0.05, -0.05, 0.1);
+
+  EXPECT_TRUE(axes.deadzoneApplied);
+  EXPECT_EQ(axes.x, 0);
+  EXPECT_EQ(axes.y, 0);
+}
+
+TEST(InputUtilsTest, DeadzoneIsCircular) {
+  // Each axis is inside the deadzone on its own, but not combined
+  auto axes = CalculateCircularDeadzone(0.08, 0.08, 0.1);
+
+  EXPECT_FALSE(axes.deadzoneApplied);
+  EXPECT_EQ(axes.x, 0.08);
+  EXPECT_EQ(axes.y, 0.08);
+}
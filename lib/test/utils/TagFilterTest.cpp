@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "subzero/utils/TagFilter.h"
+
+using namespace subzero;
+
+namespace {
+const std::vector<std::pair<std::string, std::set<std::string>>> kAutos{
+    {"Left 2 Piece", {"Left", "2 Piece"}},
+    {"Left 3 Piece", {"Left", "3 Piece"}},
+    {"Center 2 Piece", {"Center", "2 Piece"}},
+    {"Leave", {}}};
+} // namespace
+
+TEST(TagFilterTest, AnyKeepsEverything) {
+  auto matches = TagFilter::Filter(kAutos, {"ANY", "ANY"});
+
+  EXPECT_EQ(matches, (std::vector<std::string>{"Left 2 Piece", "Left 3 Piece",
+                                               "Center 2 Piece", "Leave"}));
+}
+
+TEST(TagFilterTest, KeepsEntriesWithEverySelectedTag) {
+  EXPECT_EQ(TagFilter::Filter(kAutos, {"Left", "ANY"}),
+            (std::vector<std::string>{"Left 2 Piece", "Left 3 Piece"}));
+  EXPECT_EQ(TagFilter::Filter(kAutos, {"Left", "2 Piece"}),
+            (std::vector<std::string>{"Left 2 Piece"}));
+}
+
+TEST(TagFilterTest, NoMatchesIsEmpty) {
+  EXPECT_TRUE(TagFilter::Filter(kAutos, {"Center", "3 Piece"}).empty());
+}
+
+TEST(TagFilterTest, NoGroupsKeepsEverything) {
+  EXPECT_EQ(TagFilter::Filter(kAutos, {}).size(), kAutos.size());
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/kinematics/SwerveModulePosition.h>
+#include <photon/targeting/PhotonPipelineResult.h>
+#include <wpi/DataLogWriter.h>
+#include <wpi/timestamp.h>
+
+#include <array>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "subzero/vision/VisionReplay.h"
+
+using namespace subzero;
+
+namespace {
+std::string TempLogPath() {
+  return (std::filesystem::temp_directory_path() / "subzero_replay_test.wpilog")
+      .string();
+}
+
+// Every kind of input once, in a known order. Returns the recorded Photon
+// result's timestamp
+units::second_t WriteLog(const std::string &path) {
+  std::error_code ec;
+  wpi::log::DataLogWriter log{path, ec};
+  EXPECT_FALSE(ec) << ec.message();
+
+  // NT received the frame before the other inputs were logged, like a frame
+  // that arrived earlier in the loop than the observer ran
+  photon::PhotonPipelineResult result;
+  result.SetReceiveTimestamp(units::microsecond_t(wpi::Now() - 1000));
+
+  VisionReplayRecorder recorder{&log};
+  recorder.RecordLimelightJson("limelight", "{\"Results\":{}}");
+  std::vector<double> detections{1, 0, 0.9, 10, 20, 50, 80};
+  recorder.RecordDetections("coral", detections);
+  recorder.RecordPhotonResult("front", result);
+  recorder.RecordRobotPose(frc::Pose2d{1_m, 2_m, frc::Rotation2d{0.5_rad}});
+  std::array<frc::SwerveModulePosition, 4> modules{
+      {{1_m, frc::Rotation2d{0_rad}},
+       {2_m, frc::Rotation2d{0.1_rad}},
+       {3_m, frc::Rotation2d{0.2_rad}},
+       {4_m, frc::Rotation2d{0.3_rad}}}};
+  recorder.RecordOdometry(frc::Rotation2d{1.5_rad}, modules);
+  recorder.RecordOutput("Estimate", frc::Pose2d{3_m, 4_m, frc::Rotation2d{}});
+  log.Flush();
+  return result.GetTimestamp();
+}
+} // namespace
+
+TEST(VisionReplayTest, RoundTripsEveryInput) {
+  std::string path = TempLogPath();
+  units::second_t recordedPhotonTime = WriteLog(path);
+
+  auto replayer = VisionReplayer::Load(path);
+  ASSERT_TRUE(replayer.has_value());
+
+  std::vector<std::string> order;
+  units::second_t photonTime = 0_s;
+  units::second_t photonResultTime = 0_s;
+  std::vector<frc::SwerveModulePosition> replayedModules;
+  frc::Rotation2d replayedGyro;
+
+  VisionReplayHandlers handlers{
+      .limelightJson =
+          [&](units::second_t, std::string_view name,
+              const std::string &json) {
+            order.push_back("limelight");
+            EXPECT_EQ(name, "limelight");
+            EXPECT_EQ(json, "{\"Results\":{}}");
+          },
+      .detections =
+          [&](units::second_t, std::string_view source,
+              const std::vector<double> &values) {
+            order.push_back("detections");
+            EXPECT_EQ(source, "coral");
+            EXPECT_EQ(values.size(), 7u);
+          },
+      .photonResult =
+          [&](units::second_t timestamp, std::string_view camera,
+              const photon::PhotonPipelineResult &result) {
+            order.push_back("photon");
+            EXPECT_EQ(camera, "front");
+            photonTime = timestamp;
+            photonResultTime = result.GetTimestamp();
+          },
+      .robotPose =
+          [&](units::second_t, const frc::Pose2d &pose) {
+            order.push_back("pose");
+            EXPECT_EQ(pose, (frc::Pose2d{1_m, 2_m, frc::Rotation2d{0.5_rad}}));
+          },
+      .odometry =
+          [&](units::second_t, const frc::Rotation2d &gyroAngle,
+              std::span<const frc::SwerveModulePosition> modulePositions) {
+            order.push_back("odometry");
+            replayedGyro = gyroAngle;
+            replayedModules.assign(modulePositions.begin(),
+                                   modulePositions.end());
+          }};
+
+  auto stats = replayer->Run(handlers);
+
+  EXPECT_EQ(stats.records, 5u);
+  // The Photon result replays at its receive time, ahead of the inputs
+  // logged before it
+  EXPECT_EQ(order, (std::vector<std::string>{"photon", "limelight",
+                                             "detections", "pose",
+                                             "odometry"}));
+  EXPECT_EQ(photonResultTime, recordedPhotonTime);
+  EXPECT_EQ(photonTime, recordedPhotonTime);
+
+  EXPECT_EQ(replayedGyro, frc::Rotation2d{1.5_rad});
+  ASSERT_EQ(replayedModules.size(), 4u);
+  EXPECT_EQ(replayedModules[2].distance, 3_m);
+  EXPECT_EQ(replayedModules[3].angle, frc::Rotation2d{0.3_rad});
+
+  replayer->CompareOutput("Estimate", photonTime,
+                          frc::Pose2d{3_m, 4_m, frc::Rotation2d{}});
+  auto &comparison = replayer->GetComparisons().find("Estimate")->second;
+  EXPECT_EQ(comparison.samples, 1u);
+  EXPECT_EQ(comparison.mismatches, 0u);
+
+  std::filesystem::remove(path);
+}
+
+TEST(VisionReplayTest, MissingFileFailsToLoad) {
+  EXPECT_FALSE(VisionReplayer::Load("/nonexistent/replay.wpilog").has_value());
+}